@@ -1,603 +1,10634 @@
 #pragma once
 
-#include <typeinfo>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <unordered_map>
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <memory>
+#include <new>
+#include <memory_resource>
+#include <array>
+#include <algorithm>
+#include <tuple>
+#include <optional>
+#include <cstring>
 #include <assert.h>
 #include <stdexcept>
+#include <istream>
+#include <ostream>
+
+//! Define the number of lock stripes that the keys of each value type are distributed across
+#ifndef BLACKBOARD_STRIPE_COUNT
+#define BLACKBOARD_STRIPE_COUNT 8
+#endif
+
+//! Define the number of parts that each stripe is split into by a parallel for-each, so that the sweep can be spread across more tasks than there are stripes
+#ifndef BLACKBOARD_PARALLEL_PARTS
+#define BLACKBOARD_PARALLEL_PARTS 8
+#endif
+
+//! Define the number of subscribers that can be stored for a key before the list is moved to the heap
+#ifndef BLACKBOARD_INLINE_SUBSCRIBERS
+#define BLACKBOARD_INLINE_SUBSCRIBERS 2
+#endif
+
+//! Define the number of compile time keys that the process wide key table caches for resolving without locking (must be a power of two)
+#ifndef BLACKBOARD_TYPED_KEY_CACHE
+#define BLACKBOARD_TYPED_KEY_CACHE 4096
+#endif
+
+//! Define BLACKBOARD_STATS to record access statistics for each type and key, statements wrapped in BLACKBOARD_STAT are only compiled when it is defined
+#ifdef BLACKBOARD_STATS
+#define BLACKBOARD_STAT(...) __VA_ARGS__
+#else
+#define BLACKBOARD_STAT(...)
+#endif
+
+//! Define the storage policy that is used for value types that don't specify their own
+#ifndef BLACKBOARD_STORAGE_POLICY
+#define BLACKBOARD_STORAGE_POLICY Utilities::Templates::NodeStorage
+#endif
+
+//! Probe the control bytes of the flat map with SSE2 where it is available
+#if !defined(BLACKBOARD_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BLACKBOARD_FLAT_MAP_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//! Allow coroutines to await key changes when compiled as C++20 with coroutine support, unless BLACKBOARD_NO_COROUTINES is defined
+#if !defined(BLACKBOARD_NO_COROUTINES) && defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define BLACKBOARD_COROUTINES
+#include <coroutine>
+#endif
+#endif
 
 namespace Utilities {
     //! Forward declare the base type of the data storage object
-    namespace Templates { class BaseMap; }
+    namespace Templates { class BaseMap; class KeyTable; class CodecTable; class BaseBatch; template<typename T> class ValueBatch; }
 
-    //! Define alias' for the different types of event callbacks that can be defined
-    template<typename T> using EventKeyCallback = void(*)(const std::string&);
-    template<typename T> using EventValueCallback = void(*)(const T&);
-    template<typename T> using EventKeyValueCallback = void(*)(const std::string&, const T&);
+    namespace Templates {
+    #ifdef BLACKBOARD_STATS
+        /*
+         *      Name: StatCounter
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store a statistic that can be added to by any number
+         *      of threads at once. Copying the counter copies its
+         *      current value, so that it can be held by records that
+         *      are moved between containers.
+        **/
+        struct StatCounter {
+            //! Store the current value of the statistic
+            std::atomic<uint64_t> mValue{ 0 };
 
-    /*
-     *      Name: Blackboard 
-     *      Author: Mitchell Croft
-     *      Created: 08/11/2016
-     *      Modified: 09/11/2016
-     *      
-     *      Purpose:
-     *      Provide a singleton location for a user to store
-     *      generic data in a easily accessible location. 
-     *      
-     *      Callback functionality will be implemented to allow 
-     *      listening for when specific keyed data is changed. 
-     *      
-     *      The create and destroy functions must be called 
-     *      prior to use.
-     *      
-     *      Warning:
-     *      Data types stored on the blackboard must have valid
-     *      default and copy constructors defined as well as the
-     *      assignment operator.
-     *      
-     *      Only one callback event of each type will be kept for 
-     *      each key of every value type. 
-    **/
-    class Blackboard {
-        /*----------Singleton Values----------*/
-        static Blackboard* mInstance;
-        Blackboard() = default;
-        ~Blackboard() = default;
+            //! Construction/assignment
+            StatCounter() = default;
+            StatCounter(const StatCounter& pOther) : mValue(pOther.load()) {}
+            inline StatCounter& operator=(const StatCounter& pOther) { mValue.store(pOther.load(), std::memory_order_relaxed); return *this; }
 
-        /*----------Variables----------*/
+            //! Counter management
+            inline void add(uint64_t pAmount = 1) { mValue.fetch_add(pAmount, std::memory_order_relaxed); }
+            inline uint64_t load() const { return mValue.load(std::memory_order_relaxed); }
+            inline void reset() { mValue.store(0, std::memory_order_relaxed); }
+        };
 
-        //! Store a map of all of the different value types
-        std::unordered_map<size_t, Templates::BaseMap*> mDataStorage;
+        //! Store the number of times a lock was contended and the total time spent waiting for it
+        struct LockStats {
+            StatCounter mContended;
+            StatCounter mWaitNanoseconds;
+            inline void reset() { mContended.reset(); mWaitNanoseconds.reset(); }
+        };
 
-        //! Store a mutex for locking data when in use
-        std::recursive_mutex mDataLock;
+        //! Store the access statistics of a value type
+        struct TypeStats {
+            StatCounter mReads;
+            StatCounter mWrites;
+            StatCounter mCallbacks;
+            StatCounter mCallbackNanoseconds;
+            LockStats mLock;
+            StatCounter mAllocatedBytes;
+            inline void reset() { mReads.reset(); mWrites.reset(); mCallbacks.reset(); mCallbackNanoseconds.reset(); mLock.reset(); }
+        };
 
-        //! Convert a template type into a unique ID value
-        template<typename T> inline size_t templateToID() const;
+        //! Store the access statistics of a single key of a value type
+        struct KeyStats {
+            StatCounter mReads;
+            StatCounter mWrites;
+        };
 
-        //! Ensure that a ValueMap objects exists for a specific type
-        template<typename T> inline size_t supportType();
+        /*
+         *      Name: CallbackTimer
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Add the number of callback events raised within a
+         *      scope and the time taken to raise them to the
+         *      statistics of a value type.
+        **/
+        class CallbackTimer {
+            //! Store the statistics that the time is added to
+            TypeStats& mStats;
 
-    public:
-        //! Creation/destruction
-        /*----------------*/ static bool create();
-        /*----------------*/ static void destroy();
+            //! Store the time that the callback events started
+            const std::chrono::steady_clock::time_point mStart;
 
-        //! Data reading/writing
-        template<typename T> static void write(const std::string& pKey, const T& pValue, bool pRaiseCallbacks = true);
-        template<typename T> static const T& read(const std::string& pKey);
-        template<typename T> static void wipeTypeKey(const std::string& pKey);
-        /*----------------*/ static void wipeKey(const std::string& pKey);
-        /*----------------*/ static void wipeBoard(bool pWipeCallbacks = false);
+        public:
+            //! Constructor/Destructor
+            CallbackTimer(TypeStats& pStats, size_t pCount) : mStats(pStats), mStart(std::chrono::steady_clock::now()) { mStats.mCallbacks.add(pCount); }
+            ~CallbackTimer() { mStats.mCallbackNanoseconds.add((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count()); }
+        };
+    #endif
 
-        //! Callback functions
-        template<typename T> static void subscribe(const std::string& pKey, EventKeyCallback<T> pCb);
-        template<typename T> static void subscribe(const std::string& pKey, EventValueCallback<T> pCb);
-        template<typename T> static void subscribe(const std::string& pKey, EventKeyValueCallback<T> pCb);
-        template<typename T> static void unsubscribe(const std::string& pKey);
-        /*----------------*/ static void unsubscribeAll(const std::string& pKey);
+        /*
+         *      Name: SharedRecursiveMutex
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Provide a reader-writer lock that allows any number
+         *      of threads to hold shared ownership at once, while
+         *      still allowing the thread with exclusive ownership
+         *      to re-lock it (shared or exclusive) from within
+         *      callback events.
+         *      
+         *      Warning:
+         *      A thread holding shared ownership must not attempt
+         *      to acquire exclusive ownership, as this will deadlock,
+         *      or to acquire shared ownership again, which the
+         *      underlying lock doesn't allow.
+        **/
+        class SharedRecursiveMutex {
+            /*----------Variables----------*/
 
-        //! Getters
-        /*----------------*/ static inline bool isReady() { return (mInstance != nullptr); }
-    };
+            //! Store the underlying reader-writer lock
+            std::shared_timed_mutex mLock;
+
+            //! Store the thread that currently has exclusive ownership 
+            std::atomic<std::thread::id> mOwner;
+
+            //! Store the number of times the owning thread has locked the mutex
+            unsigned int mDepth;
+
+        #ifdef BLACKBOARD_STATS
+            //! Store the statistics that contended waits for the mutex are added to, or nullptr if they aren't recorded
+            LockStats* mStats = nullptr;
+
+            //! Lock the underlying mutex after an attempt to lock it without waiting failed, timing the wait
+            template<typename TFunc> inline void waitFor(TFunc pLock);
+        #endif
+
+        public:
+            //! Constructor
+            SharedRecursiveMutex() : mOwner(std::thread::id()), mDepth(0) {}
+
+        #ifdef BLACKBOARD_STATS
+            //! Set the statistics that contended waits for the mutex are added to
+            inline void setStats(LockStats* pStats) { mStats = pStats; }
+        #endif
+
+            //! Exclusive ownership
+            void lock();
+            void unlock();
+
+            //! Shared ownership
+            void lock_shared();
+            void unlock_shared();
+        };
 
-    namespace Templates {
         /*
-         *      Name: BaseMap
+         *      Name: KeyHash
          *      Author: Mitchell Croft
-         *      Created: 08/11/2016
-         *      Modified: 08/11/2016
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
          *      
          *      Purpose:
-         *      Provide a base point for the templated ValueMap
-         *      objects to inherit from. This allows the 
-         *      blackboard to store pointers to the templated 
-         *      versions for storing data.
+         *      Hash string keys by their characters so that maps
+         *      keyed on std::string can be searched with a 
+         *      std::string_view without constructing a temporary
+         *      string object.
         **/
-        class BaseMap { 
-        protected:
-            //! Set the Value map to be a friend of the blackboard to allow for construction/destruction of the object
-            friend class Blackboard;
+        struct KeyHash {
+            using is_transparent = void;
+            inline size_t operator()(std::string_view pKey) const { return std::hash<std::string_view>()(pKey); }
+        };
+
+        //! Hash the text of a key with 64-bit FNV-1a, so that keys declared at compile time are hashed by the compiler
+        constexpr uint64_t hashKey(std::string_view pKey) {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : pKey) hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+            return hash;
+        }
+
+        //! Define the map type used to store data against string keys
+        template<typename TValue> using KeyMap = std::unordered_map<std::string, TValue, KeyHash, std::equal_to<>>;
+
+        //! Provide a heterogeneous lookup function for the KeyMap type
+        template<typename TValue> inline typename KeyMap<TValue>::iterator findKey(KeyMap<TValue>& pMap, std::string_view pKey);
+
+        //! Find the index of the lowest set bit of a mask
+        inline unsigned int lowestBit(uint32_t pMask);
+
+        /*
+         *      Name: SmallVector
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store a contiguous list of trivially copyable values,
+         *      keeping up to TInline of them inside the object
+         *      itself before moving to a heap allocation.
+        **/
+        template<typename TValue, size_t TInline>
+        class SmallVector {
+            static_assert(std::is_trivially_copyable<TValue>::value, "SmallVector can only store trivially copyable types");
+            static_assert(TInline > 0, "SmallVector must have space for at least one inline value");
+
+            /*----------Variables----------*/
+
+            //! Store the values that are in use
+            TValue* mData;
+            size_t mSize;
+            size_t mCapacity;
+
+            //! Store the inline storage for the values
+            alignas(TValue) unsigned char mInline[TInline * sizeof(TValue)];
+
+            /*----------Functions----------*/
+
+            //! Get the inline storage
+            inline TValue* inlineData() { return reinterpret_cast<TValue*>(mInline); }
+
+            //! Release the heap allocation if there is one
+            inline void release();
+
+        public:
+            //! Construction/destruction
+            SmallVector() : mData(inlineData()), mSize(0), mCapacity(TInline) {}
+            SmallVector(const SmallVector& pOther) : SmallVector() { *this = pOther; }
+            SmallVector(SmallVector&& pOther) noexcept : SmallVector() { *this = std::move(pOther); }
+            inline SmallVector& operator=(const SmallVector& pOther);
+            inline SmallVector& operator=(SmallVector&& pOther) noexcept;
+            ~SmallVector() { release(); }
+
+            //! Modification
+            inline void reserve(size_t pCapacity);
+            inline void push_back(const TValue& pValue) { const TValue value = pValue; if (mSize == mCapacity) reserve(mCapacity * 2); mData[mSize++] = value; }
+            inline void assign(const TValue* pBegin, const TValue* pEnd);
+            inline void erase(size_t pIndex);
+            inline void clear() { mSize = 0; }
+
+            //! Access
+            inline TValue& operator[](size_t pIndex) { return mData[pIndex]; }
+            inline const TValue& operator[](size_t pIndex) const { return mData[pIndex]; }
+            inline const TValue* begin() const { return mData; }
+            inline const TValue* end() const { return mData + mSize; }
+            inline size_t size() const { return mSize; }
+            inline bool empty() const { return (mSize == 0); }
+        };
+
+        /*
+         *      Name: FlatMap
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store values against atom IDs in a single contiguous
+         *      array using open addressing. A parallel array of
+         *      control bytes holds 7 bits of each key's hash, which
+         *      are compared 16 at a time to find candidate slots
+         *      without touching the values themselves. Both arrays
+         *      are allocated from the map's memory resource.
+         *      
+         *      Warning:
+         *      Inserting a new key may move every value in the map,
+         *      invalidating all references and iterators to them.
+         *      The number of times this has happened is tracked by
+         *      getRelocations.
+        **/
+        template<typename TValue>
+        class FlatMap {
+        public:
+            //! Define the type of the entries stored in the map
+            typedef std::pair<uint32_t, TValue> Slot;
+
+            /*
+             *      Name: FlatMap::iterator
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Step through the occupied slots of a FlatMap
+            **/
+            class iterator {
+                //! Set the map to be a friend to allow for construction
+                friend class FlatMap;
+
+                //! Store the map and slot index that the iterator refers to
+                FlatMap* mMap;
+                size_t mIndex;
+
+                //! Construct the iterator at a slot index
+                iterator(FlatMap* pMap, size_t pIndex) : mMap(pMap), mIndex(pIndex) {}
+
+            public:
+                //! Access
+                inline Slot& operator*() const { return mMap->mSlots[mIndex]; }
+                inline Slot* operator->() const { return &mMap->mSlots[mIndex]; }
+
+                //! Advance to the next occupied slot
+                inline iterator& operator++() { mIndex = mMap->nextOccupied(mIndex + 1); return *this; }
+
+                //! Comparison
+                inline bool operator==(const iterator& pOther) const { return (mIndex == pOther.mIndex); }
+                inline bool operator!=(const iterator& pOther) const { return (mIndex != pOther.mIndex); }
+            };
+
+        private:
+            //! Define the number of control bytes that are compared at once
+            static constexpr size_t GROUP_WIDTH = 16;
+
+            //! Define the control byte values of slots that don't hold a value
+            static constexpr int8_t CTRL_EMPTY = -128;
+            static constexpr int8_t CTRL_DELETED = -2;
+
+            /*----------Variables----------*/
+
+            //! Store the control bytes and slots of the map
+            int8_t* mCtrl;
+            Slot* mSlots;
+
+            //! Store the number of slots, the number of values and the number of empty slots that can be filled before growing
+            size_t mCapacity;
+            size_t mSize;
+            size_t mGrowthLeft;
+
+            //! Store the number of times that the values have been moved to a new array
+            size_t mRelocations;
+
+            //! Store the memory resource that the arrays are allocated from
+            std::pmr::memory_resource* mResource;
+
+            /*----------Functions----------*/
+
+            //! Hashing
+            static inline uint64_t hash(uint32_t pKey) { return (uint64_t)pKey * 0x9E3779B97F4A7C15ull; }
+            static inline int8_t controlHash(uint64_t pHash) { return (int8_t)(pHash >> 57); }
+            static inline size_t maxLoad(size_t pCapacity) { return pCapacity - pCapacity / 8; }
+
+            //! Compare a group of control bytes, returning a bit mask of the matches
+            static inline uint32_t matchByte(const int8_t* pGroup, int8_t pByte);
+            static inline uint32_t matchFree(const int8_t* pGroup);
+
+            //! Slot searching
+            inline size_t findIndex(uint32_t pKey) const;
+            inline size_t findFree(uint64_t pHash) const;
+            inline size_t nextOccupied(size_t pIndex) const;
+            inline size_t prepareInsert(uint64_t pHash);
+            inline void commitInsert(size_t pIndex, uint64_t pHash);
+            inline void rehash(size_t pCapacity);
+            inline void releaseArrays(int8_t* pCtrl, Slot* pSlots, size_t pCapacity);
+
+        public:
+            //! Construction/destruction
+            explicit FlatMap(std::pmr::memory_resource* pResource = std::pmr::get_default_resource()) : mCtrl(nullptr), mSlots(nullptr), mCapacity(0), mSize(0), mGrowthLeft(0), mRelocations(0), mResource(pResource) {}
+            FlatMap(const FlatMap&) = delete;
+            FlatMap& operator=(const FlatMap&) = delete;
+            ~FlatMap();
+
+            //! Iteration
+            inline iterator begin() { return iterator(this, nextOccupied(0)); }
+            inline iterator end() { return iterator(this, mCapacity); }
+            inline iterator seek(size_t pSlot) { return iterator(this, nextOccupied(std::min(pSlot, mCapacity))); }
+
+            //! Lookup
+            inline iterator find(uint32_t pKey) { return iterator(this, findIndex(pKey)); }
+            inline TValue& operator[](uint32_t pKey) { return try_emplace(pKey).first->second; }
+            inline const TValue* get(uint32_t pKey) const { const size_t index = findIndex(pKey); return (index != mCapacity ? &mSlots[index].second : nullptr); }
+
+            //! Modification
+            template<typename TArg> inline std::pair<iterator, bool> insert_or_assign(uint32_t pKey, TArg&& pValue);
+            template<typename... TArgs> inline std::pair<iterator, bool> try_emplace(uint32_t pKey, TArgs&&... pArgs);
+            inline size_t erase(uint32_t pKey);
+            inline void clear();
+
+            //! Getters
+            inline size_t size() const { return mSize; }
+            inline bool empty() const { return (mSize == 0); }
+            inline size_t getRelocations() const { return mRelocations; }
+            inline size_t getCapacity() const { return mCapacity; }
+        };
+
+        /*
+         *      Name: EventQueue
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the notifications of keys that have changed
+         *      while callback events are being deferred. Any number
+         *      of threads can push notifications without locking,
+         *      they are taken as a single batch when flushed.
+        **/
+        class EventQueue {
+        public:
+            //! Forward declare the notification type
+            struct Node;
+
+        private:
+            /*----------Variables----------*/
+
+            //! Store the most recently pushed notification
+            std::atomic<Node*> mHead;
+
+            //! Store the flag that indicates if callback events are being deferred
+            std::atomic<bool> mDeferring;
+
+        public:
+            //! Construction/destruction
+            EventQueue() : mHead(nullptr), mDeferring(false) {}
+            EventQueue(const EventQueue&) = delete;
+            EventQueue& operator=(const EventQueue&) = delete;
+            ~EventQueue() { clear(); }
+
+            //! Queue management
+            void push(Node* pNode);
+            Node* takeAll();
+            void clear();
+
+            //! Deferral flag
+            inline bool isDeferring() const { return mDeferring.load(std::memory_order_acquire); }
+            inline void setDeferring(bool pDefer) { mDeferring.store(pDefer, std::memory_order_release); }
+        };
+
+    #ifdef BLACKBOARD_COROUTINES
+        /*
+         *      Name: KeyWaiter
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store a coroutine that is suspended until a key changes,
+         *      linked into the list of waiters of that key. Waiters are
+         *      stored in the frame of the awaiting coroutine.
+        **/
+        struct KeyWaiter {
+            //! Store the next waiter in the same list
+            KeyWaiter* mNext = nullptr;
+
+            //! Store the coroutine to resume, and the function that resumes it or nullptr to resume it directly
+            std::coroutine_handle<> mHandle;
+            void(*mResume)(std::coroutine_handle<>, void*) = nullptr;
+            void* mUserData = nullptr;
+
+            //! Store the flags that indicate if the waiter is in the list of its key, and if it was woken by a write rather than a wipe
+            bool mWaiting = false;
+            bool mWritten = false;
+        };
+
+        /*
+         *      Name: WakeList
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Collect the waiters that were taken from their keys
+         *      while a stripe was locked, resuming them in order when
+         *      the list is destroyed. Lists are declared before the
+         *      lock of the stripe so that they outlive it.
+        **/
+        class WakeList {
+            /*----------Variables----------*/
+
+            //! Store the first and last waiters to resume
+            KeyWaiter* mHead = nullptr;
+            KeyWaiter* mTail = nullptr;
+
+        public:
+            //! Construction/destruction
+            WakeList() = default;
+            WakeList(const WakeList&) = delete;
+            WakeList& operator=(const WakeList&) = delete;
+            inline ~WakeList() {
+                //Read each waiter before it is resumed, as resuming can destroy it
+                for (KeyWaiter* waiter = mHead; waiter;) {
+                    KeyWaiter* next = waiter->mNext;
+                    const std::coroutine_handle<> handle = waiter->mHandle;
+                    if (waiter->mResume) waiter->mResume(handle, waiter->mUserData);
+                    else handle.resume();
+                    waiter = next;
+                }
+            }
+
+            //! Add a list of waiters to the end of those that are resumed
+            inline void add(KeyWaiter* pList) {
+                if (!pList) return;
+                KeyWaiter* tail = pList;
+                while (tail->mNext) tail = tail->mNext;
+                (mTail ? mTail->mNext : mHead) = pList;
+                mTail = tail;
+            }
+        };
+    #endif
+
+        /*
+         *      Name: SnapshotFrame
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the published snapshot buffers of each of the
+         *      value types of a Board for a single frame. Each
+         *      Snapshot pins the frame it reads from, a publish
+         *      waits for the frame to be unpinned and marks it as
+         *      being written before rebuilding it, so readers never
+         *      see a frame change while they hold it.
+        **/
+        struct SnapshotFrame {
+            //! Define the flag that is added to the reader count while the frame is being rebuilt
+            static constexpr size_t WRITING = (size_t)1 << (sizeof(size_t) * 8 - 1);
+
+            //! Store the snapshot value buffer of each type, indexed by the type ID
+            std::pmr::vector<const void*> mTypes;
+
+            //! Store the number of the publish that built the frame
+            size_t mNumber;
+
+            //! Store the number of Snapshots that pin the frame, with the WRITING flag while it is rebuilt
+            mutable std::atomic<size_t> mReaders;
+
+            //! Construct an empty frame
+            explicit SnapshotFrame(std::pmr::memory_resource* pResource) : mTypes(pResource), mNumber(0), mReaders(0) {}
+        };
+
+        /*
+         *      Name: TypeIndex
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the IDs of the value types that hold a record
+         *      for each key of a Board, so that operations on every
+         *      type of a key only visit the Value maps that hold it.
+         *      
+         *      Types are added when a key gains a record and removed
+         *      when the record is erased by a wipe or unsubscribe of
+         *      the key. Records erased by other means leave their type
+         *      listed until the key is next wiped or unsubscribed, so
+         *      the index may hold extra types but never misses one.
+        **/
+        class TypeIndex {
+            /*----------Variables----------*/
+
+            /*
+             *      Name: Stripe
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Store the subset of the keys that are guarded
+             *      by a single lock
+            **/
+            struct Stripe {
+                //! Construct the stripe with the memory resource used by its map
+                explicit Stripe(std::pmr::memory_resource* pResource) : mTypes(pResource) {}
+
+                //! Store a mutex for locking the stripe when in use
+                std::mutex mLock;
+
+                //! Store the type IDs that hold each key
+                std::pmr::unordered_map<uint32_t, SmallVector<uint32_t, 2>> mTypes;
+            };
+
+            //! Store the stripes that the keys are distributed across
+            std::array<Stripe, BLACKBOARD_STRIPE_COUNT> mStripes;
+
+            /*----------Functions----------*/
+
+            //! Construct each of the stripes with the memory resource
+            template<size_t... TIndices> static inline std::array<Stripe, sizeof...(TIndices)> createStripes(std::pmr::memory_resource* pResource, std::index_sequence<TIndices...>) { return {{ ((void)TIndices, Stripe(pResource))... }}; }
+
+            //! Find the stripe that a key belongs to
+            inline Stripe& getStripe(uint32_t pID) { return mStripes[pID % BLACKBOARD_STRIPE_COUNT]; }
+
+        public:
+            //! Constructor
+            explicit TypeIndex(std::pmr::memory_resource* pResource) : mStripes(createStripes(pResource, std::make_index_sequence<BLACKBOARD_STRIPE_COUNT>())) {}
+
+            //! Index management
+            void add(uint32_t pID, uint32_t pType);
+            void remove(uint32_t pID, uint32_t pType);
+            void find(uint32_t pID, SmallVector<uint32_t, 8>& pOut);
+        };
+
+        /*
+         *      Name: TimerWheel
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the times that values written with a lifetime
+         *      expire at, so that advancing the time only visits the
+         *      timers that have expired.
+         *      
+         *      Times are in milliseconds of a clock chosen by the
+         *      caller. Timers are held in a hierarchy of wheels, where
+         *      each slot of a level spans the whole of the level below
+         *      it. As the time reaches a slot its timers are moved
+         *      down a level, so a timer is moved at most once per
+         *      level before it expires. Timers are not removed when
+         *      their value is overwritten or wiped, the Value map
+         *      ignores timers that no longer match the expiry of
+         *      the value.
+        **/
+        class TimerWheel {
+        public:
+            //! Store a single timer
+            struct Timer {
+                uint64_t mDeadline;
+                BaseMap* mMap;
+                uint32_t mID;
+            };
+
+        private:
+            /*----------Variables----------*/
+
+            //! Define the number of slots in each level and the number of levels
+            static constexpr size_t SLOT_BITS = 6;
+            static constexpr size_t SLOT_COUNT = size_t(1) << SLOT_BITS;
+            static constexpr size_t LEVEL_COUNT = 4;
+
+            //! Store the timers of each slot of the levels
+            std::vector<Timer> mSlots[LEVEL_COUNT][SLOT_COUNT];
+
+            //! Store the number of timers held by each level
+            size_t mCounts[LEVEL_COUNT];
+
+            //! Store the timers that were already due when they were placed
+            std::vector<Timer> mDue;
+
+            //! Store the current time of the wheel
+            uint64_t mNow;
+
+            //! Store a mutex for locking the wheel when in use
+            std::mutex mLock;
+
+            /*----------Functions----------*/
+
+            //! Add a timer to the slot that it is next handled in
+            void place(const Timer& pTimer);
+
+        public:
+            //! Constructor
+            TimerWheel() : mCounts{}, mNow(0) {}
+
+            //! Timer management
+            uint64_t schedule(BaseMap* pMap, uint32_t pID, uint64_t pLifetime);
+            void advance(uint64_t pNow, std::vector<Timer>& pOut);
+            void clear();
+        };
+
+        /*
+         *      Name: ArchiveWriter
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Collect the binary data of a saved Board in memory,
+         *      along with the keys that it refers to. Keys are
+         *      written as indices into the key table of the archive
+         *      rather than as strings.
+         *      
+         *      Values are written in the byte order of the host.
+        **/
+        class ArchiveWriter {
+            /*----------Variables----------*/
+
+            //! Store the data that has been written
+            std::vector<char> mBuffer;
+
+            //! Store the key table index of each atom ID plus one, or 0 if the key hasn't been written
+            std::vector<uint32_t> mIndices;
+
+            //! Store the atom IDs of the keys in the order they were added to the key table
+            std::vector<uint32_t> mKeys;
+
+        public:
+            //! Data writing
+            inline void write(const void* pData, size_t pSize) { mBuffer.insert(mBuffer.end(), (const char*)pData, (const char*)pData + pSize); }
+            template<typename TValue> inline void write(const TValue& pValue) { static_assert(std::is_trivially_copyable<TValue>::value, "Only trivially copyable values can be written directly"); write(&pValue, sizeof(TValue)); }
+            template<typename TValue> inline void overwrite(size_t pOffset, const TValue& pValue) { assert(pOffset + sizeof(TValue) <= mBuffer.size()); std::memcpy(mBuffer.data() + pOffset, &pValue, sizeof(TValue)); }
+            inline void writeString(std::string_view pValue) { write((uint32_t)pValue.size()); write(pValue.data(), pValue.size()); }
+            inline void align(size_t pAlignment) { mBuffer.resize((mBuffer.size() + pAlignment - 1) / pAlignment * pAlignment, 0); }
+            inline void truncate(size_t pSize) { assert(pSize <= mBuffer.size()); mBuffer.resize(pSize); }
+
+            //! Key table
+            uint32_t indexKey(uint32_t pID);
+
+            //! Getters
+            inline size_t getOffset() const { return mBuffer.size(); }
+            inline const std::vector<char>& getBuffer() const { return mBuffer; }
+            inline const std::vector<uint32_t>& getKeys() const { return mKeys; }
+        };
+
+        /*
+         *      Name: ArchiveReader
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Read the binary data of a saved Board from either a
+         *      stream or a block of memory, such as a mapped file.
+         *      Data in memory is viewed in place, streamed data is
+         *      read into a buffer that is reused by each view. The
+         *      buffer grows in chunks as the bytes arrive, so a
+         *      corrupt size fails once the stream runs out instead
+         *      of allocating the whole size up front.
+        **/
+        class ArchiveReader {
+            /*----------Variables----------*/
+
+            //! Define the number of bytes that the stream buffer grows by at a time
+            static constexpr size_t StreamChunk = 64 * 1024;
+
+            //! Store the stream that data is read from, or nullptr if it is read from memory
+            std::istream* mStream;
+
+            //! Store the memory that data is read from
+            const char* mData;
+            size_t mSize;
+
+            //! Store the number of bytes that have been read from the start of the archive
+            size_t mOffset;
+
+            //! Store the buffer that streamed data is viewed through
+            std::vector<char> mBuffer;
+
+        public:
+            //! Constructors
+            explicit ArchiveReader(std::istream& pStream) : mStream(&pStream), mData(nullptr), mSize(0), mOffset(0) {}
+            ArchiveReader(const void* pData, size_t pSize) : mStream(nullptr), mData((const char*)pData), mSize(pSize), mOffset(0) {}
+
+            //! Data reading
+            const void* view(size_t pSize);
+            bool read(void* pData, size_t pSize);
+            template<typename TValue> inline bool read(TValue& pValue) { static_assert(std::is_trivially_copyable<TValue>::value, "Only trivially copyable values can be read directly"); return read(&pValue, sizeof(TValue)); }
+            bool readString(std::string& pValue);
+            bool skip(size_t pSize);
+            inline bool align(size_t pAlignment) { return skip((pAlignment - mOffset % pAlignment) % pAlignment); }
+
+            //! Getters
+            inline size_t getOffset() const { return mOffset; }
+            inline size_t getRemaining() const { return (mStream ? SIZE_MAX : mSize - mOffset); }
+        };
+
+        /*
+         *      Name: Codec
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Define how values of a type are saved and loaded.
+         *      Trivially copyable types are copied as a single block
+         *      of values by default. Other types must specialise the
+         *      Codec, setting IsBlock to false and providing the
+         *      functions
+         *      
+         *          static void encode(ArchiveWriter&, const T&);
+         *          static bool decode(ArchiveReader&, T&);
+         *      
+         *      The specialisation must be visible before the type is
+         *      registered with the Blackboard.
+        **/
+        template<typename T> struct Codec {
+            static_assert(std::is_trivially_copyable<T>::value, "Types that aren't trivially copyable must specialise Templates::Codec to be saved");
+            static constexpr bool IsBlock = true;
+        };
+
+        //! Save strings by their length and characters
+        template<> struct Codec<std::string> {
+            static constexpr bool IsBlock = false;
+            static inline void encode(ArchiveWriter& pWriter, const std::string& pValue) { pWriter.writeString(pValue); }
+            static inline bool decode(ArchiveReader& pReader, std::string& pValue) { return pReader.readString(pValue); }
+        };
+
+        //! Store the encoding of each value of a type that was last replicated, by the atom ID of its key
+        typedef std::unordered_map<uint32_t, std::vector<char>> DeltaBaseline;
+
+        //! Define the operations that a replicated delta applies to a key
+        enum class EDelta : uint8_t { Erase, Value, Patch };
+
+        /*
+         *      Name: NodeStorage
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Storage policy that keeps each stripe's values in
+         *      node based std::unordered_map containers. References
+         *      to stored values remain valid until they are erased.
+        **/
+        struct NodeStorage {
+            template<typename TValue> using Map = std::pmr::unordered_map<uint32_t, TValue>;
+            template<typename TValue> static inline size_t relocations(const Map<TValue>&) { return 0; }
+
+            //! Visit the values held in one of a number of equal ranges of the map's buckets
+            template<typename TValue, typename TFunc>
+            static inline void visit(Map<TValue>& pMap, size_t pPart, size_t pPartCount, TFunc&& pFunc) {
+                const size_t buckets = pMap.bucket_count();
+                for (size_t b = buckets * pPart / pPartCount, last = buckets * (pPart + 1) / pPartCount; b < last; b++)
+                    for (auto it = pMap.begin(b); it != pMap.end(b); ++it) pFunc(*it);
+            }
+        };
+
+        /*
+         *      Name: FlatStorage
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Storage policy that keeps each stripe's values in
+         *      contiguous open addressing FlatMap containers.
+         *      References to stored values are only valid until the
+         *      next new key is added to the same stripe.
+        **/
+        struct FlatStorage {
+            template<typename TValue> using Map = FlatMap<TValue>;
+            template<typename TValue> static inline size_t relocations(const Map<TValue>& pMap) { return pMap.getRelocations(); }
+
+            //! Visit the values held in one of a number of equal ranges of the map's slots
+            template<typename TValue, typename TFunc>
+            static inline void visit(Map<TValue>& pMap, size_t pPart, size_t pPartCount, TFunc&& pFunc) {
+                const size_t slots = pMap.getCapacity();
+                for (auto it = pMap.seek(slots * pPart / pPartCount), last = pMap.seek(slots * (pPart + 1) / pPartCount); it != last; ++it) pFunc(*it);
+            }
+        };
+
+        /*
+         *      Name: StoragePolicy
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Select the storage policy used for a value type. This
+         *      can be specialised for individual types, the
+         *      specialisation must be visible before the type is
+         *      first used with the Blackboard.
+        **/
+        template<typename T> struct StoragePolicy { typedef BLACKBOARD_STORAGE_POLICY Type; };
+
+        //! Forward declare the templated data storage object
+        template<typename T, typename TStorage = typename StoragePolicy<T>::Type> class ValueMap;
+    }
+
+    //! Define alias' for the different types of event callbacks that can be defined
+    template<typename T> using EventKeyCallback = void(*)(const std::string&);
+    template<typename T> using EventValueCallback = void(*)(const T&);
+    template<typename T> using EventKeyValueCallback = void(*)(const std::string&, const T&);
+
+    //! Define alias' for the event callbacks that are passed a user supplied context pointer
+    template<typename T> using EventKeyContextCallback = void(*)(const std::string&, void*);
+    template<typename T> using EventValueContextCallback = void(*)(const T&, void*);
+    template<typename T> using EventKeyValueContextCallback = void(*)(const std::string&, const T&, void*);
+
+    /*
+     *      Name: Blackboard 
+     *      Author: Mitchell Croft
+     *      Created: 08/11/2016
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Provide a singleton location for a user to store
+     *      generic data in a easily accessible location. 
+     *      
+     *      Callback functionality will be implemented to allow 
+     *      listening for when specific keyed data is changed. 
+     *      
+     *      The create and destroy functions must be called 
+     *      prior to use.
+     *      
+     *      Warning:
+     *      Data types stored on the blackboard must have a valid
+     *      default constructor to be read before they are written.
+     *      Writing a constant reference requires a copy constructor
+     *      and assignment operator, move-only types can be stored
+     *      using rvalue writes, emplace or modify.
+     *      
+     *      Any number of callback events can be subscribed to
+     *      each key of every value type, they are raised in the
+     *      order that they were subscribed.
+     *      
+     *      Handles retrieved from the Blackboard are not thread
+     *      safe, each thread should retrieve its own Handle for
+     *      a key.
+     *      
+     *      Each value type is stored in its own Value map, with
+     *      keys distributed across BLACKBOARD_STRIPE_COUNT lock
+     *      stripes. Reading values that already exist only
+     *      requires shared access to a single stripe, and writes
+     *      to different types or stripes do not contend.
+     *      
+     *      Callback events are raised after the stripe has been
+     *      unlocked, value callbacks receive a copy of the value
+     *      that was written. Events for types that can't be copied
+     *      are raised while the stripe is still locked.
+     *      
+     *      While events are deferred, writes only queue a single
+     *      notification for each changed key. The callback events
+     *      are raised with the current value of the key when
+     *      flushEvents is called.
+     *      
+     *      Key strings are interned into a process wide table the
+     *      first time they are written or subscribed to. Using a
+     *      Key object directly skips hashing the key string.
+     *      
+     *      The containers used to store each value type are chosen
+     *      by BLACKBOARD_STORAGE_POLICY, or by specialising
+     *      Templates::StoragePolicy for the type. References and
+     *      pointers to values held with Templates::FlatStorage
+     *      are invalidated when a new key is added to their stripe.
+    **/
+    class Blackboard {
+    public:
+        //! Forward declare the interned key type
+        class Key;
+
+        //! Forward declare the compile time key type
+        template<typename T> class TypedKey;
+
+        //! Forward declare the pre-resolved key type
+        template<typename T> class Handle;
+
+        //! Forward declare the callback subscription token type
+        class Subscription;
+
+        //! Forward declare the independent board type
+        class Board;
+
+        //! Forward declare the published read only view type
+        class Snapshot;
+
+        //! Forward declare the batched write type
+        class Batch;
+
+        //! Forward declare the cross process value region type
+        class SharedRegion;
+
+        //! Forward declare the delta replication type
+        class Replicator;
+
+    #ifdef BLACKBOARD_COROUTINES
+        //! Forward declare the awaitable key change type, and the callback that can be given the coroutines it resumes
+        template<typename T> class Changed;
+        typedef void(*ResumeCallback)(std::coroutine_handle<> pHandle, void* pUserData);
+    #endif
+
+        //! Forward declare the access statistics type, and the callback that can be passed them
+        struct Stats;
+        typedef void(*StatsCallback)(const Stats& pStats, void* pUserData);
+
+    private:
+        /*----------Singleton Values----------*/
+        static Board* mInstance;
+        Blackboard() = default;
+        ~Blackboard() = default;
+
+        //! Store the memory pool that the singleton Board allocates from, this is nullptr if it uses the default resource
+        static std::pmr::memory_resource* mPool;
+
+        //! Store a counter used to give each Board a unique epoch
+        static std::atomic<size_t> mEpochCounter;
+
+        //! Store a counter used to assign each value type a unique index
+        static std::atomic<size_t> mTypeCounter;
+
+        //! Convert a template type into a unique ID value
+        template<typename T> static inline size_t templateToID();
+
+    public:
+        //! Creation/destruction
+        /*----------------*/ static bool create(bool pPooled = false);
+        /*----------------*/ static void destroy(bool pBackground = false);
+        /*----------------*/ static void waitForTeardown();
+
+        //! Data reading/writing
+        template<typename T> static void write(std::string_view pKey, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> static void write(const Key& pKey, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> static const T& read(std::string_view pKey);
+        template<typename T> static const T& read(const Key& pKey);
+        template<typename T> static bool tryRead(std::string_view pKey, T& pOut);
+        template<typename T> static bool tryRead(const Key& pKey, T& pOut);
+        template<typename T> static const T* find(std::string_view pKey);
+        template<typename T> static const T* find(const Key& pKey);
+        template<typename T> static Handle<T> getHandle(std::string_view pKey);
+        template<typename T> static Handle<T> getHandle(const Key& pKey);
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> static void write(std::string_view pKey, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> static void write(const Key& pKey, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename... TArgs> static void emplace(std::string_view pKey, TArgs&&... pArgs);
+        template<typename T, typename... TArgs> static void emplace(const Key& pKey, TArgs&&... pArgs);
+        template<typename T, typename TFunc> static void modify(std::string_view pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T, typename TFunc> static void modify(const Key& pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> static void write(Handle<T>& pHandle, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> static void write(Handle<T>& pHandle, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename TFunc> static void modify(Handle<T>& pHandle, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> static const T& read(Handle<T>& pHandle);
+        template<typename T> static void wipeTypeKey(std::string_view pKey);
+        template<typename T> static void wipeTypeKey(const Key& pKey);
+        /*----------------*/ static void wipeKey(std::string_view pKey);
+        /*----------------*/ static void wipeKey(const Key& pKey);
+        /*----------------*/ static void wipeBoard(bool pWipeCallbacks = false);
+
+        //! Expiring values
+        template<typename T> static void write(std::string_view pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks = true);
+        template<typename T> static void write(const Key& pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks = true);
+        /*----------------*/ static size_t tick(std::chrono::milliseconds pNow, bool pRaiseCallbacks = true);
+
+        //! Callback functions
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventKeyCallback<T> pCb);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventKeyCallback<T> pCb);
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventValueCallback<T> pCb);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventValueCallback<T> pCb);
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventKeyValueCallback<T> pCb);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventKeyValueCallback<T> pCb);
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventKeyContextCallback<T> pCb, void* pUserData);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventKeyContextCallback<T> pCb, void* pUserData);
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> static Subscription subscribe(std::string_view pKey, EventKeyValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> static Subscription subscribe(const Key& pKey, EventKeyValueContextCallback<T> pCb, void* pUserData);
+        /*----------------*/ static void unsubscribe(const Subscription& pSubscription);
+        template<typename T> static void unsubscribe(std::string_view pKey);
+        template<typename T> static void unsubscribe(const Key& pKey);
+        /*----------------*/ static void unsubscribeAll(std::string_view pKey);
+        /*----------------*/ static void unsubscribeAll(const Key& pKey);
+
+        //! Typed keys
+        template<typename T> static void write(const TypedKey<T>& pKey, const typename TypedKey<T>::Type& pValue, bool pRaiseCallbacks = true);
+        template<typename T> static const T& read(const TypedKey<T>& pKey);
+        template<typename T> static bool tryRead(const TypedKey<T>& pKey, T& pOut);
+        template<typename T> static const T* find(const TypedKey<T>& pKey);
+        template<typename T> static Handle<T> getHandle(const TypedKey<T>& pKey);
+        template<typename T, typename TFunc> static void modify(const TypedKey<T>& pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> static void wipeTypeKey(const TypedKey<T>& pKey);
+        template<typename T> static Subscription subscribe(const TypedKey<T>& pKey, EventKeyCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> static Subscription subscribe(const TypedKey<T>& pKey, EventValueCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> static Subscription subscribe(const TypedKey<T>& pKey, EventKeyValueCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> static void unsubscribe(const TypedKey<T>& pKey);
+
+        //! Deferred callback events
+        /*----------------*/ static void setDeferredEvents(bool pDefer);
+        /*----------------*/ static size_t flushEvents();
+
+        //! Snapshots
+        /*----------------*/ static void setSnapshotMode(bool pEnabled);
+        /*----------------*/ static size_t publish();
+        /*----------------*/ static inline Snapshot getSnapshot();
+
+        //! Batching
+        /*----------------*/ static inline Batch batch(bool pRaiseCallbacks = true);
+        template<typename T> static void find(const Key* pKeys, size_t pCount, const T** pOut);
+
+        //! Change tracking
+        template<typename T> static uint64_t getVersion(std::string_view pKey);
+        template<typename T> static uint64_t getVersion(const Key& pKey);
+        template<typename T> static uint64_t changedSince(uint64_t pVersion, std::vector<Key>& pOut);
+        /*----------------*/ static uint64_t changedSince(uint64_t pVersion, std::vector<Key>& pOut);
+
+        //! Bulk iteration
+        template<typename T, typename TFunc> static size_t forEach(TFunc&& pFunc);
+        template<typename T, typename TFunc> static size_t forEachParallel(TFunc&& pFunc);
+        template<typename T, typename TFunc, typename TRunner> static size_t forEachParallel(TFunc&& pFunc, TRunner&& pRunner);
+
+        //! Serialisation
+        template<typename T> static bool registerType(std::string_view pName);
+        /*----------------*/ static bool save(std::ostream& pStream);
+        /*----------------*/ static bool load(std::istream& pStream, bool pRaiseCallbacks = false);
+        /*----------------*/ static bool load(const void* pData, size_t pSize, bool pRaiseCallbacks = false);
+
+        //! Shared memory
+        template<typename T> static bool share(SharedRegion* pRegion);
+
+    #ifdef BLACKBOARD_COROUTINES
+        //! Coroutines
+        template<typename T> static Changed<T> changed(std::string_view pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+        template<typename T> static Changed<T> changed(const Key& pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+        template<typename T> static Changed<T> changed(const TypedKey<T>& pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+    #endif
+
+        //! Statistics
+        /*----------------*/ static void getStats(Stats& pOut);
+        /*----------------*/ static void resetStats();
+        /*----------------*/ static void dumpStats(std::ostream& pStream);
+        /*----------------*/ static void dumpStats(StatsCallback pCallback, void* pUserData = nullptr);
+
+        //! Getters
+        /*----------------*/ static inline bool isReady() { return (mInstance != nullptr); }
+        /*----------------*/ static inline Board& getBoard() { assert(mInstance); return *mInstance; }
+        /*----------------*/ static inline bool isDeferringEvents();
+        /*----------------*/ static inline bool isSnapshotting();
+        /*----------------*/ static inline uint64_t getVersion();
+    };
+
+    /*
+     *      Name: Blackboard::Key
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store an interned key value as a 32-bit atom. The key
+     *      string is hashed once when the Key is constructed, after
+     *      which the atom is used for all lookups on the Blackboard.
+     *      
+     *      The key text is stored once in a process wide table and
+     *      remains valid for the lifetime of the program.
+    **/
+    class Blackboard::Key {
+        //! Set the key table to be a friend to allow for the construction of valid keys
+        friend class Templates::KeyTable;
+
+        /*----------Variables----------*/
+
+        //! Store the atom ID of the key
+        uint32_t mID;
+
+        //! Store a pointer to the interned text of the key
+        const std::string* mText;
+
+        //! Construct a key from its interned values
+        Key(uint32_t pID, const std::string* pText) : mID(pID), mText(pText) {}
+
+    public:
+        //! Constructors
+        Key() : mID(0), mText(nullptr) {}
+        explicit Key(std::string_view pKey);
+
+        //! Getters
+        inline bool isValid() const { return (mText != nullptr); }
+        inline uint32_t getID() const { return mID; }
+        inline const std::string& getText() const { assert(mText); return *mText; }
+
+        //! Comparison
+        inline bool operator==(const Key& pOther) const { return (mText == pOther.mText); }
+        inline bool operator!=(const Key& pOther) const { return (mText != pOther.mText); }
+    };
+
+    /*
+     *      Name: Blackboard::TypedKey
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Declare a key and the type of its value at compile time,
+     *      such as constexpr BlackboardKey<Vec3> TargetPos{ "target_pos" }.
+     *      The text is hashed by the compiler, and the functions that
+     *      take a TypedKey use the type of the key, so it can't be
+     *      read or written as any other type.
+     *      
+     *      The precomputed hash finds the interned Key in a lock free
+     *      cache of the process wide key table, so after the first use
+     *      the text isn't hashed again and the table isn't locked.
+     *      
+     *      Warning:
+     *      The text must outlive the TypedKey, which is always the case
+     *      for string literals.
+    **/
+    template<typename T>
+    class Blackboard::TypedKey {
+        /*----------Variables----------*/
+
+        //! Store the text of the key and its hash
+        std::string_view mText;
+        uint64_t mHash;
+
+    public:
+        //! Define the type of the value stored at the key
+        typedef T Type;
+
+        //! Constructors
+        constexpr explicit TypedKey(std::string_view pText) : mText(pText), mHash(Templates::hashKey(pText)) {}
+
+        //! Find the interned Key, adding it to the key table the first time it is used
+        inline Key resolve() const;
+
+        //! Getters
+        constexpr std::string_view getText() const { return mText; }
+        constexpr uint64_t getHash() const { return mHash; }
+    };
+
+    //! Define an alias for declaring compile time keys outside of the Blackboard
+    template<typename T> using BlackboardKey = Blackboard::TypedKey<T>;
+
+    /*
+     *      Name: Blackboard::Subscription
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Identify a single callback event that was subscribed
+     *      to a key, so that it can be removed without affecting
+     *      the other subscribers of the key.
+     *      
+     *      A Subscription from before the Blackboard was recreated,
+     *      or from a different Board, is ignored when unsubscribing.
+    **/
+    class Blackboard::Subscription {
+        //! Set the Board to be a friend to allow for the construction of valid tokens
+        friend class Utilities::Blackboard::Board;
+
+        /*----------Variables----------*/
+
+        //! Store the key that the callback event was subscribed to
+        Key mKey;
+
+        //! Store the type ID and Board epoch that the callback event was subscribed with
+        size_t mType;
+        size_t mEpoch;
+
+        //! Store the ID of the subscriber within the key's list
+        uint32_t mID;
+
+        //! Construct a token for a subscriber
+        Subscription(const Key& pKey, size_t pType, size_t pEpoch, uint32_t pID) : mKey(pKey), mType(pType), mEpoch(pEpoch), mID(pID) {}
+
+    public:
+        //! Constructors
+        Subscription() : mType(0), mEpoch(0), mID(0) {}
+
+        //! Getters
+        inline bool isValid() const { return (mID != 0); }
+        inline const Key& getKey() const { return mKey; }
+    };
+
+    /*
+     *      Name: EventQueue::Node
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store a single notification that a key of a Value map
+     *      has changed and has callback events to raise
+    **/
+    struct Templates::EventQueue::Node {
+        Node* mNext;
+        BaseMap* mMap;
+        Blackboard::Key mKey;
+    };
+
+    /*
+     *      Name: Blackboard::Handle
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store a pre-resolved reference to the value slot of a 
+     *      key for a specific type. Reading and writing through a
+     *      Handle skips the type and key lookups once the slot has
+     *      been resolved.
+     *      
+     *      The slot remains valid across rehashes of the underlying
+     *      map and is re-resolved automatically if the key is wiped,
+     *      the Blackboard is recreated or the Handle is used with
+     *      a different Board.
+    **/
+    template<typename T>
+    class Blackboard::Handle {
+        //! Set the Board and Value map to be friends to allow for resolving of the slot
+        friend class Utilities::Blackboard::Board;
+        friend class Templates::ValueMap<T>;
+
+        /*----------Variables----------*/
+
+        //! Store the key that this Handle refers to
+        Key mKey;
+
+        //! Store the Value map, stripe and record that the key was resolved to
+        Templates::ValueMap<T>* mMap;
+        size_t mStripe;
+        typename Templates::ValueMap<T>::Record* mSlot;
+
+        //! Store the Board epoch and stripe generation that the slot was resolved at
+        size_t mEpoch;
+        size_t mGeneration;
+
+    public:
+        //! Constructors
+        Handle() : mMap(nullptr), mStripe(0), mSlot(nullptr), mEpoch(0), mGeneration(0) {}
+        explicit Handle(const Key& pKey) : mKey(pKey), mMap(nullptr), mStripe(0), mSlot(nullptr), mEpoch(0), mGeneration(0) {}
+
+        //! Getters
+        inline const Key& getKey() const { return mKey; }
+    };
+
+#ifdef BLACKBOARD_COROUTINES
+    /*
+     *      Name: Blackboard::Changed
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Suspend a coroutine until a key of a specific type is
+     *      next written or wiped, as returned by changed<T>. The
+     *      result of the co_await is true if the key was written
+     *      and false if its value was wiped.
+     *      
+     *      The waiter is stored in the awaiting coroutine's frame
+     *      and linked into the list of its key, so waiting doesn't
+     *      allocate or poll and costs nothing until the key changes.
+     *      Writes that raise callback events take the waiters of
+     *      the key and resume them once the stripe is released. A
+     *      coroutine is resumed on the writing thread, or passed to
+     *      the ResumeCallback so that it can be resumed elsewhere.
+     *      
+     *      Warning:
+     *      The Board must outlive the coroutines that are waiting on
+     *      it. A waiting coroutine can be destroyed, which removes it
+     *      from its key, but not while another thread may write the
+     *      key. Waiters are resumed even while events are deferred.
+    **/
+    template<typename T>
+    class Blackboard::Changed {
+        //! Set the Board to be a friend to allow for the construction of awaiters
+        friend class Utilities::Blackboard::Board;
+
+        /*----------Variables----------*/
+
+        //! Store the Board and the key that are waited on
+        Board* mBoard;
+        Key mKey;
+
+        //! Store the Value map that the waiter was added to, or nullptr if it hasn't been suspended
+        Templates::ValueMap<T>* mMap;
+
+        //! Store the waiter that is linked into the list of the key
+        Templates::KeyWaiter mWaiter;
+
+        /*----------Functions----------*/
+
+        //! Construct the awaiter for a key of a Board
+        Changed(Board& pBoard, const Key& pKey, ResumeCallback pResume, void* pUserData);
+
+    public:
+        //! Construction/destruction
+        Changed(const Changed&) = delete;
+        Changed& operator=(const Changed&) = delete;
+        ~Changed();
+
+        //! Awaiting
+        inline bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> pHandle);
+        bool await_resume() const noexcept;
+    };
+#endif
+
+    /*
+     *      Name: Blackboard::Snapshot
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Provide read only access to the values of a Board as
+     *      they were at the last publish. Reading from a Snapshot
+     *      with a Key doesn't take any locks, and the references
+     *      that it returns don't change while the Snapshot, or a
+     *      copy of it, is held.
+     *      
+     *      Warning:
+     *      The Board double buffers its snapshots, a held Snapshot
+     *      pins its frame and the second publish after it was
+     *      retrieved waits for it to be released. Readers should
+     *      retrieve a new Snapshot each frame, and a thread must
+     *      release its Snapshots before publishing twice. Values
+     *      of types that can't be copied are not included.
+    **/
+    class Blackboard::Snapshot {
+        //! Set the Board to be a friend to allow for the construction of valid Snapshots
+        friend class Utilities::Blackboard::Board;
+
+        /*----------Variables----------*/
+
+        //! Store the frame that the Snapshot reads from
+        const Templates::SnapshotFrame* mFrame;
+
+        //! Construct a Snapshot of a published frame that has already been pinned
+        explicit Snapshot(const Templates::SnapshotFrame* pFrame) : mFrame(pFrame) {}
+
+    public:
+        //! Construction/destruction
+        Snapshot() : mFrame(nullptr) {}
+        Snapshot(const Snapshot& pOther) : mFrame(pOther.mFrame) { if (mFrame) mFrame->mReaders.fetch_add(1, std::memory_order_relaxed); }
+        Snapshot(Snapshot&& pOther) noexcept : mFrame(pOther.mFrame) { pOther.mFrame = nullptr; }
+        Snapshot& operator=(Snapshot pOther) noexcept { std::swap(mFrame, pOther.mFrame); return *this; }
+        ~Snapshot() { release(); }
+
+        //! Unpin the frame, leaving the Snapshot invalid
+        inline void release() {
+            if (mFrame) mFrame->mReaders.fetch_sub(1, std::memory_order_release);
+            mFrame = nullptr;
+        }
+
+        //! Data reading
+        template<typename T> inline const T* find(const Key& pKey) const;
+        template<typename T> inline const T* find(std::string_view pKey) const;
+        template<typename T> inline bool tryRead(const Key& pKey, T& pOut) const;
+
+        //! Getters
+        inline bool isValid() const { return (mFrame != nullptr); }
+        inline size_t getFrame() const { return (mFrame ? mFrame->mNumber : 0); }
+    };
+
+    /*
+     *      Name: Blackboard::Batch
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Collect writes to a Board so that they can be applied
+     *      together. Committing resolves the Value map of each type
+     *      once and locks each of its stripes once, rather than for
+     *      every write.
+     *      
+     *      Callback events are raised once for each key that was
+     *      written, after all of the writes of its type have been
+     *      applied, with the value the key holds at that point.
+     *      
+     *      The writes are committed when the Batch is destroyed.
+     *      A Batch keeps its buffers between commits, so it can be
+     *      reused every tick without allocating.
+     *      
+     *      Warning:
+     *      A Batch is not thread safe and must not outlive its Board.
+     *      Writes are not visible to readers until they are committed.
+    **/
+    class Blackboard::Batch {
+        //! Set the Board to be a friend to allow for the construction of valid Batches
+        friend class Utilities::Blackboard::Board;
+
+        /*----------Variables----------*/
+
+        //! Store the Board that the writes are applied to
+        Board* mBoard;
+
+        //! Store the flag that indicates if callback events are raised when the writes are applied
+        bool mRaiseCallbacks;
+
+        //! Store the writes for each of the types that have been written
+        std::vector<std::unique_ptr<Templates::BaseBatch>> mTypes;
+
+        /*----------Functions----------*/
+
+        //! Construct an empty Batch for a Board
+        Batch(Board& pBoard, bool pRaiseCallbacks) : mBoard(&pBoard), mRaiseCallbacks(pRaiseCallbacks) {}
+
+        //! Retrieve the list of writes for a type, creating it if it doesn't exist
+        template<typename T> inline std::vector<std::pair<Key, T>>& getWrites();
+
+    public:
+        //! Construction/destruction
+        Batch(Batch&&) = default;
+        Batch& operator=(Batch&& pOther);
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+        ~Batch();
+
+        //! Data writing
+        template<typename T> inline Batch& write(std::string_view pKey, const T& pValue) { return write<T>(Key(pKey), pValue); }
+        template<typename T> inline Batch& write(const Key& pKey, const T& pValue);
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> inline Batch& write(std::string_view pKey, T&& pValue) { return write<T>(Key(pKey), std::move(pValue)); }
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> inline Batch& write(const Key& pKey, T&& pValue);
+
+        //! Apply the writes
+        size_t commit();
+
+        //! Getters
+        size_t size() const;
+    };
+
+    /*
+     *      Name: Blackboard::Stats
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store the access statistics that have been recorded
+     *      for a Board. Statistics are only recorded when
+     *      BLACKBOARD_STATS is defined, otherwise mEnabled is
+     *      false and the lists are empty.
+     *      
+     *      Keys are listed for each type that they have been
+     *      read or written as. The counts of a key are dropped
+     *      when its record is erased.
+    **/
+    struct Blackboard::Stats {
+        /*
+         *      Name: Blackboard::Stats::Type
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the statistics of a single value type
+        **/
+        struct Type {
+            //! Store the type ID and the name it was registered with, this is empty if the type isn't registered
+            size_t mType;
+            std::string mName;
+
+            //! Store the number of reads and writes of values of the type
+            uint64_t mReads;
+            uint64_t mWrites;
+
+            //! Store the number of callback events raised and the total time spent raising them
+            uint64_t mCallbacks;
+            uint64_t mCallbackNanoseconds;
+
+            //! Store the number of times a stripe lock was contended and the total time spent waiting for them
+            uint64_t mContended;
+            uint64_t mWaitNanoseconds;
+
+            //! Store the number of bytes allocated when the Value map was created
+            uint64_t mAllocatedBytes;
+        };
+
+        //! Store the number of reads and writes of a key as a single type
+        struct KeyAccess {
+            Key mKey;
+            size_t mType;
+            uint64_t mReads;
+            uint64_t mWrites;
+        };
+
+        //! Store the flag that indicates if statistics are being recorded
+        bool mEnabled = false;
+
+        //! Store the number of times the type registry lock was contended and the total time spent waiting for it
+        uint64_t mRegistryContended = 0;
+        uint64_t mRegistryWaitNanoseconds = 0;
+
+        //! Store the statistics of each type, and of each key that has been accessed
+        std::vector<Type> mTypes;
+        std::vector<KeyAccess> mKeys;
+    };
+
+    /*
+     *      Name: Blackboard::SharedRegion
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store trivially copyable values in a named region of
+     *      shared memory, so that other processes can map the same
+     *      region and read them directly, without serialising the
+     *      values or any other communication.
+     *      
+     *      Values are identified by the text of their key and the
+     *      name that their type was registered with, so each process
+     *      must register the types it shares with the same names.
+     *      Keys are found through a fixed capacity index that is
+     *      searched and extended without locking. Each value has a
+     *      sequence counter, writers in any process take turns to
+     *      change it and readers retry if a write overlapped them.
+     *      
+     *      A Board mirrors every value of a type into a region when
+     *      Board::share is called, so the process that owns the Board
+     *      writes to it as normal while others read from the region.
+     *      
+     *      Warning:
+     *      Keys are never removed from a region, erasing a value only
+     *      marks it as absent. New keys can't be added once the index
+     *      or the data area is full. A process that is terminated while
+     *      writing a value leaves it locked. The region is removed when
+     *      the object that created it is closed, processes that have
+     *      already opened it keep their mapping until they close it.
+    **/
+    class Blackboard::SharedRegion {
+        //! Set the Value maps to be friends to allow them to mirror their values into the region
+        template<typename T, typename TStorage> friend class Templates::ValueMap;
+
+        /*----------Variables----------*/
+
+        //! Define the identifiers of the region layout
+        static constexpr char Magic[8] = { 'B', 'B', 'S', 'H', 'A', 'R', 'E', 'D' };
+        static constexpr uint32_t Version = 1;
+
+        //! Define the alignment of each part of the region
+        static constexpr size_t Alignment = 64;
+
+        //! Define the states of the header and of each index entry
+        static constexpr uint32_t STATE_EMPTY = 0;
+        static constexpr uint32_t STATE_CLAIMED = 1;
+        static constexpr uint32_t STATE_READY = 2;
+
+        //! Define the flags stored in the sequence of a value
+        static constexpr uint32_t SEQUENCE_WRITING = 1;
+        static constexpr uint32_t SEQUENCE_PRESENT = 2;
+        static constexpr uint32_t SEQUENCE_STEP = 4;
+
+        //! Store the description of the region at the start of the mapping
+        struct Header {
+            char mMagic[8];
+            uint32_t mVersion;
+            uint32_t mCapacity;
+            uint64_t mDataSize;
+            std::atomic<uint64_t> mDataUsed;
+            std::atomic<uint32_t> mCount;
+            std::atomic<uint32_t> mState;
+        };
+
+        //! Store a key of the index, the offsets are relative to the start of the data area
+        struct Entry {
+            std::atomic<uint32_t> mState;
+            uint32_t mNameLength;
+            uint64_t mHash;
+            uint64_t mName;
+            uint64_t mSlot;
+        };
+
+        //! Store the sequence and size of a value, the bytes of the value follow it as 64-bit words
+        struct Slot {
+            std::atomic<uint32_t> mSequence;
+            uint32_t mSize;
+        };
+
+        //! Store the start and size of the mapping
+        void* mBase;
+        size_t mSize;
+
+        //! Store the platform handle of the mapping, or -1 if the region isn't open
+        intptr_t mHandle;
+
+        //! Store the name of the region and the flag that indicates if this object created it
+        std::string mName;
+        bool mOwner;
+
+        /*----------Functions----------*/
+
+        //! Get the parts of the mapping
+        inline Header* getHeader() const { return (Header*)mBase; }
+        inline Entry* getEntries() const { return (Entry*)((char*)mBase + Alignment); }
+        inline char* getData(uint32_t pCapacity) const { return (char*)mBase + getDataOffset(pCapacity); }
+
+        //! Get the layout of a region
+        static inline size_t getDataOffset(uint32_t pCapacity) { return (Alignment + pCapacity * sizeof(Entry) + Alignment - 1) / Alignment * Alignment; }
+        static inline size_t getLayoutSize(uint32_t pCapacity, uint64_t pDataSize) { return getDataOffset(pCapacity) + (size_t)pDataSize; }
+
+        //! Find the name that a type was registered with, or nullptr if it hasn't been
+        template<typename T> static inline const std::string* findType();
+
+        //! Find the slot of a value, adding the key to the index if requested
+        Slot* findSlot(std::string_view pKey, std::string_view pType, uint32_t pSize, bool pCreate);
+
+        //! Untyped value access, used by the templated functions and Value maps
+        bool write(std::string_view pKey, std::string_view pType, const void* pValue, uint32_t pSize);
+        bool read(std::string_view pKey, std::string_view pType, void* pOut, uint32_t pSize);
+        bool erase(std::string_view pKey, std::string_view pType, uint32_t pSize);
+
+    public:
+        //! Construction/destruction
+        SharedRegion() : mBase(nullptr), mSize(0), mHandle(-1), mOwner(false) {}
+        SharedRegion(const SharedRegion&) = delete;
+        SharedRegion& operator=(const SharedRegion&) = delete;
+        ~SharedRegion() { close(); }
+
+        //! Mapping
+        bool create(std::string_view pName, uint32_t pCapacity = 4096, size_t pDataSize = 1 << 20);
+        bool open(std::string_view pName);
+        void close();
+        static bool remove(std::string_view pName);
+
+        //! Data reading/writing
+        template<typename T> bool write(std::string_view pKey, const T& pValue);
+        template<typename T> bool write(const Key& pKey, const T& pValue);
+        template<typename T> bool tryRead(std::string_view pKey, T& pOut);
+        template<typename T> bool tryRead(const Key& pKey, T& pOut);
+        template<typename T> bool erase(std::string_view pKey);
+        template<typename T> bool erase(const Key& pKey);
+
+        //! Getters
+        inline bool isOpen() const { return (mBase != nullptr); }
+        inline const std::string& getName() const { return mName; }
+        inline uint32_t getCount() const { return (mBase ? getHeader()->mCount.load(std::memory_order_acquire) : 0); }
+        inline uint32_t getCapacity() const { return (mBase ? getHeader()->mCapacity : 0); }
+        inline size_t getDataSize() const { return (mBase ? (size_t)getHeader()->mDataSize : 0); }
+    };
+
+    /*
+     *      Name: Blackboard::Replicator
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Replicate the values of registered types from one Board
+     *      to another, such as one in a different process or on
+     *      another machine, by sending only the values that have
+     *      changed. The sending Replicator captures a packet each
+     *      tick and the receiving Replicator applies it.
+     *      
+     *      A capture finds the changed keys of each type from the
+     *      version log of the Board, so its cost and size scale
+     *      with the number of changes rather than the number of
+     *      keys. Values that match the last one sent for their key
+     *      are left out. A changed block value is sent as only the
+     *      bytes that differ when that is smaller than the value,
+     *      other values are sent encoded by their Templates::Codec.
+     *      Keys that are wiped are sent as removals.
+     *      
+     *      Packets hold the text of the keys they refer to and the
+     *      registered name of each type, so the two processes only
+     *      need to register their types with the same names.
+     *      
+     *      Warning:
+     *      Packets must be applied in the order they were captured,
+     *      without any being lost, as each one builds on the values
+     *      of those before it. A packet that is out of order fails
+     *      to apply. After a break the sender should be reset, so
+     *      that its next packet holds every value again. Replicators
+     *      are not thread safe and must not outlive their Board.
+    **/
+    class Blackboard::Replicator {
+        /*----------Variables----------*/
+
+        //! Store the Board that changes are captured from and applied to
+        Board* mBoard;
+
+        //! Store the version of the Board that the next capture starts from
+        uint64_t mVersion;
+
+        //! Store the sequence number of the next packet that is captured, and of the next packet that is expected to be applied
+        uint32_t mSequence;
+        uint32_t mExpected;
+
+        //! Store the values that were last sent and received for each type, indexed by type ID
+        std::vector<Templates::DeltaBaseline> mSent;
+        std::vector<Templates::DeltaBaseline> mReceived;
+
+    public:
+        //! Construction
+        Replicator();
+        explicit Replicator(Board& pBoard);
+        Replicator(const Replicator&) = delete;
+        Replicator& operator=(const Replicator&) = delete;
+
+        //! Replication
+        size_t capture(std::vector<char>& pOut);
+        bool apply(const void* pData, size_t pSize, bool pRaiseCallbacks = true);
+        void reset();
+
+        //! Getters
+        inline Board& getBoard() const { return *mBoard; }
+        inline uint32_t getSequence() const { return mSequence; }
+    };
+
+    /*
+     *      Name: Blackboard::Board
+     *      Author: Mitchell Croft
+     *      Created: 14/10/2026
+     *      Modified: 14/10/2026
+     *      
+     *      Purpose:
+     *      Store an independent set of keyed values and callback
+     *      events. The static Blackboard functions operate on a
+     *      singleton Board, additional Boards can be constructed
+     *      directly wherever a private set of values is needed.
+     *      
+     *      The Value maps of a Board and all of the containers
+     *      that hold their values are allocated from the memory
+     *      resource it is constructed with. A Board that is
+     *      built over a std::pmr::monotonic_buffer_resource is
+     *      torn down without individual frees, the memory is
+     *      returned when the resource is released.
+     *      
+     *      A Board can be given a parent that reads fall back to
+     *      when the key isn't held by the Board itself, walking
+     *      up the chain of parents in turn. Values found on a
+     *      parent are returned by reference without copying, and
+     *      their locations are cached by the child Board until
+     *      a Board in between gains a value with that key. 
+     *      Writes, wipes and callback events only ever affect the
+     *      Board that they are called on.
+     *      
+     *      In snapshot mode the Board tracks the keys that change
+     *      between calls to publish. Each publish brings the older
+     *      of two snapshot buffers up to date and makes it current,
+     *      so readers can use a Snapshot for the rest of the frame
+     *      without locking. A publish waits for the Snapshots of the
+     *      buffer it rebuilds to be released.
+     *      
+     *      A Batch collects writes to any number of keys and types,
+     *      applying them when it is committed with each stripe locked
+     *      once. The callback events of each key are raised once per
+     *      commit, with the value that the key holds afterwards.
+     *      
+     *      Every change to a key is stamped with the current version
+     *      of the Board. Calling changedSince finds the keys that
+     *      changed from a version onwards in proportion to the number
+     *      of changes, and starts a new version for the next call.
+     *      
+     *      The values of types that have been registered with
+     *      Blackboard::registerType can be saved to a binary
+     *      archive and loaded back onto any Board. Only the values
+     *      held by the Board itself are saved, not those of its
+     *      parents or the subscribers of its keys.
+     *      
+     *      The values of registered, trivially copyable types can
+     *      be mirrored into a SharedRegion with share, so that
+     *      other processes can read them as the Board changes.
+     *      
+     *      A Replicator captures the values of registered types
+     *      that have changed since its last capture, so that they
+     *      can be sent to and applied on a Board in another process.
+     *      
+     *      When BLACKBOARD_STATS is defined the Board counts the
+     *      reads, writes and callback events of each type and key,
+     *      and times contended lock waits and callback events.
+     *      Without it the instrumentation is compiled out.
+     *      
+     *      Warning:
+     *      The memory resource and any parent Board must outlive
+     *      the Board. Keys are interned into the process wide table
+     *      and are shared by every Board. Handles and Subscriptions
+     *      re-resolve or are ignored when used with a Board other
+     *      than the one that created them.
+    **/
+    class Blackboard::Board {
+        //! Set the Blackboard to be a friend to allow for ownership of the singleton
+        friend class Utilities::Blackboard;
+
+        //! Set the batched writes to be friends to allow them to be applied
+        template<typename T> friend class Templates::ValueBatch;
+
+        //! Set the Replicator to be a friend to allow it to find the changes of each type
+        friend class Utilities::Blackboard::Replicator;
+
+    #ifdef BLACKBOARD_COROUTINES
+        //! Set the key change awaiters to be friends to allow them to find the Value map of their type
+        template<typename T> friend class Utilities::Blackboard::Changed;
+    #endif
+
+        /*----------Variables----------*/
+
+        //! Store the memory resource that Value maps are allocated from
+        std::pmr::memory_resource* mResource;
+
+        //! Store the Value maps of all of the different value types, indexed by their type ID
+        std::pmr::vector<Templates::BaseMap*> mDataStorage;
+
+        //! Store a reader-writer mutex for locking the type registry when in use
+        Templates::SharedRecursiveMutex mDataLock;
+
+        //! Store the notifications of events that have been deferred
+        Templates::EventQueue mEventQueue;
+
+        //! Store the unique epoch of the Board, used to identify the Handles and Subscriptions that belong to it
+        const size_t mEpoch;
+
+        //! Store the Board that reads fall back to when a key isn't held by this Board
+        Board* const mParent;
+
+        //! Store a counter that is incremented every time a key gains a value on this Board, used to validate cached parent lookups
+        std::atomic<size_t> mLayout;
+
+        //! Store the location of a value that was found on a parent Board
+        struct ScopeEntry {
+            Board* mOwner;
+            Templates::BaseMap* mMap;
+            size_t mStripe;
+            const void* mValue;
+            size_t mGeneration;
+            size_t mLayout;
+        };
+
+        //! Store the cached locations of parent values, indexed by their type and key IDs
+        std::pmr::unordered_map<uint64_t, ScopeEntry> mScopeCache;
+
+        //! Store a reader-writer mutex for locking the cache when in use
+        Templates::SharedRecursiveMutex mScopeLock;
+
+        //! Store the flag that indicates if changed keys are tracked for snapshots
+        std::atomic<bool> mSnapshotting;
+
+        //! Store the two snapshot frames that are published in turn, and the one that is current
+        Templates::SnapshotFrame mFrames[2];
+        std::atomic<const Templates::SnapshotFrame*> mFront;
+
+        //! Store the number of times that snapshots have been published
+        size_t mPublishCount;
+
+        //! Store a mutex for ensuring only one publish happens at a time
+        std::mutex mPublishLock;
+
+        //! Store the current version of the Board, changes are stamped with the version they were made in
+        std::atomic<uint64_t> mVersion;
+
+        //! Store the types that hold a record for each key
+        Templates::TypeIndex mTypeIndex;
+
+        //! Store the times that values written with a lifetime expire at
+        Templates::TimerWheel mTimers;
+
+    #ifdef BLACKBOARD_STATS
+        //! Store the statistics of the waits for the type registry lock
+        Templates::LockStats mRegistryStats;
+    #endif
+
+        /*----------Functions----------*/
+
+        //! Find the ValueMap object for a specific type if it exists
+        template<typename T> inline Templates::ValueMap<T>* findType();
+
+        //! Ensure that a ValueMap objects exists for a specific type
+        template<typename T> inline Templates::ValueMap<T>* supportType();
+
+        //! Ensure that a Handle is pointing at the current Value map for its type
+        template<typename T> inline Templates::ValueMap<T>* resolveHandle(Handle<T>& pHandle);
+
+        //! Add a subscriber to the callback events of a key
+        template<typename T> inline Subscription addSubscriber(const Key& pKey, const typename Templates::ValueMap<T>::Subscriber& pSubscriber);
+
+        //! Find a value on this Board or its parents, passing it to a function while it is locked
+        template<typename T, typename TFunc> inline bool visitScope(const Key& pKey, TFunc&& pFunc);
+
+        //! Sum the layout counters of the Boards from this one up to, but not including, a parent
+        inline size_t getScopeLayout(const Board* pOwner) const;
+
+        //! Save and load the values of a registered type, these are stored in the codec table
+        template<typename T> static uint32_t saveType(Templates::BaseMap* pMap, Templates::ArchiveWriter& pWriter);
+        template<typename T> static bool loadType(Board& pBoard, Templates::ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, bool pRaiseCallbacks);
+
+        //! Save and load the replicated changes of a registered type, these are stored in the codec table
+        template<typename T> static uint32_t saveDeltaType(Templates::BaseMap* pMap, Templates::ArchiveWriter& pWriter, uint64_t pVersion, Templates::DeltaBaseline& pBaseline);
+        template<typename T> static bool loadDeltaType(Board& pBoard, Templates::ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, Templates::DeltaBaseline& pBaseline, bool pRaiseCallbacks);
+
+        //! Load the values of an archive from a reader
+        bool loadArchive(Templates::ArchiveReader& pReader, bool pRaiseCallbacks);
+
+        //! Apply a list of batched writes to the Value map of their type
+        template<typename T> inline size_t writeBatch(std::vector<std::pair<Key, T>>& pWrites, bool pRaiseCallbacks);
+
+    public:
+        //! Construction/destruction
+        explicit Board(std::pmr::memory_resource* pResource = std::pmr::get_default_resource());
+        explicit Board(Board* pParent, std::pmr::memory_resource* pResource = std::pmr::get_default_resource());
+        Board(const Board&) = delete;
+        Board& operator=(const Board&) = delete;
+        ~Board();
+
+        //! Data reading/writing
+        template<typename T> void write(std::string_view pKey, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> void write(const Key& pKey, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> const T& read(std::string_view pKey);
+        template<typename T> const T& read(const Key& pKey);
+        template<typename T> bool tryRead(std::string_view pKey, T& pOut);
+        template<typename T> bool tryRead(const Key& pKey, T& pOut);
+        template<typename T> const T* find(std::string_view pKey);
+        template<typename T> const T* find(const Key& pKey);
+        template<typename T> Handle<T> getHandle(std::string_view pKey);
+        template<typename T> Handle<T> getHandle(const Key& pKey);
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> void write(std::string_view pKey, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename = std::enable_if_t<!std::is_reference<T>::value>> void write(const Key& pKey, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename... TArgs> void emplace(std::string_view pKey, TArgs&&... pArgs);
+        template<typename T, typename... TArgs> void emplace(const Key& pKey, TArgs&&... pArgs);
+        template<typename T, typename TFunc> void modify(std::string_view pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T, typename TFunc> void modify(const Key& pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> void write(Handle<T>& pHandle, const T& pValue, bool pRaiseCallbacks = true);
+        template<typename T> void write(Handle<T>& pHandle, T&& pValue, bool pRaiseCallbacks = true);
+        template<typename T, typename TFunc> void modify(Handle<T>& pHandle, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> const T& read(Handle<T>& pHandle);
+        template<typename T> void wipeTypeKey(std::string_view pKey);
+        template<typename T> void wipeTypeKey(const Key& pKey);
+        /*----------------*/ void wipeKey(std::string_view pKey);
+        /*----------------*/ void wipeKey(const Key& pKey);
+        /*----------------*/ void wipeBoard(bool pWipeCallbacks = false);
+
+        //! Expiring values
+        template<typename T> void write(std::string_view pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks = true);
+        template<typename T> void write(const Key& pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks = true);
+        /*----------------*/ size_t tick(std::chrono::milliseconds pNow, bool pRaiseCallbacks = true);
+
+        //! Callback functions
+        template<typename T> Subscription subscribe(std::string_view pKey, EventKeyCallback<T> pCb);
+        template<typename T> Subscription subscribe(const Key& pKey, EventKeyCallback<T> pCb);
+        template<typename T> Subscription subscribe(std::string_view pKey, EventValueCallback<T> pCb);
+        template<typename T> Subscription subscribe(const Key& pKey, EventValueCallback<T> pCb);
+        template<typename T> Subscription subscribe(std::string_view pKey, EventKeyValueCallback<T> pCb);
+        template<typename T> Subscription subscribe(const Key& pKey, EventKeyValueCallback<T> pCb);
+        template<typename T> Subscription subscribe(std::string_view pKey, EventKeyContextCallback<T> pCb, void* pUserData);
+        template<typename T> Subscription subscribe(const Key& pKey, EventKeyContextCallback<T> pCb, void* pUserData);
+        template<typename T> Subscription subscribe(std::string_view pKey, EventValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> Subscription subscribe(const Key& pKey, EventValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> Subscription subscribe(std::string_view pKey, EventKeyValueContextCallback<T> pCb, void* pUserData);
+        template<typename T> Subscription subscribe(const Key& pKey, EventKeyValueContextCallback<T> pCb, void* pUserData);
+        /*----------------*/ void unsubscribe(const Subscription& pSubscription);
+        template<typename T> void unsubscribe(std::string_view pKey);
+        template<typename T> void unsubscribe(const Key& pKey);
+        /*----------------*/ void unsubscribeAll(std::string_view pKey);
+        /*----------------*/ void unsubscribeAll(const Key& pKey);
+
+        //! Typed keys
+        template<typename T> void write(const TypedKey<T>& pKey, const typename TypedKey<T>::Type& pValue, bool pRaiseCallbacks = true);
+        template<typename T> const T& read(const TypedKey<T>& pKey);
+        template<typename T> bool tryRead(const TypedKey<T>& pKey, T& pOut);
+        template<typename T> const T* find(const TypedKey<T>& pKey);
+        template<typename T> Handle<T> getHandle(const TypedKey<T>& pKey);
+        template<typename T, typename TFunc> void modify(const TypedKey<T>& pKey, TFunc&& pFunc, bool pRaiseCallbacks = true);
+        template<typename T> void wipeTypeKey(const TypedKey<T>& pKey);
+        template<typename T> Subscription subscribe(const TypedKey<T>& pKey, EventKeyCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> Subscription subscribe(const TypedKey<T>& pKey, EventValueCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> Subscription subscribe(const TypedKey<T>& pKey, EventKeyValueCallback<typename TypedKey<T>::Type> pCb);
+        template<typename T> void unsubscribe(const TypedKey<T>& pKey);
+
+        //! Deferred callback events
+        /*----------------*/ void setDeferredEvents(bool pDefer);
+        /*----------------*/ size_t flushEvents();
+
+        //! Snapshots
+        /*----------------*/ void setSnapshotMode(bool pEnabled);
+        /*----------------*/ size_t publish();
+        /*----------------*/ inline Snapshot getSnapshot() const;
+
+        //! Batching
+        /*----------------*/ inline Batch batch(bool pRaiseCallbacks = true);
+        template<typename T> void find(const Key* pKeys, size_t pCount, const T** pOut);
+
+        //! Change tracking
+        template<typename T> uint64_t getVersion(std::string_view pKey);
+        template<typename T> uint64_t getVersion(const Key& pKey);
+        template<typename T> uint64_t changedSince(uint64_t pVersion, std::vector<Key>& pOut);
+        /*----------------*/ uint64_t changedSince(uint64_t pVersion, std::vector<Key>& pOut);
+
+        //! Bulk iteration
+        template<typename T, typename TFunc> size_t forEach(TFunc&& pFunc);
+        template<typename T, typename TFunc> size_t forEachParallel(TFunc&& pFunc);
+        template<typename T, typename TFunc, typename TRunner> size_t forEachParallel(TFunc&& pFunc, TRunner&& pRunner);
+
+        //! Serialisation
+        /*----------------*/ bool save(std::ostream& pStream);
+        /*----------------*/ bool load(std::istream& pStream, bool pRaiseCallbacks = false);
+        /*----------------*/ bool load(const void* pData, size_t pSize, bool pRaiseCallbacks = false);
+
+        //! Shared memory
+        template<typename T> bool share(SharedRegion* pRegion);
+
+    #ifdef BLACKBOARD_COROUTINES
+        //! Coroutines
+        template<typename T> Changed<T> changed(std::string_view pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+        template<typename T> Changed<T> changed(const Key& pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+        template<typename T> Changed<T> changed(const TypedKey<T>& pKey, ResumeCallback pResume = nullptr, void* pUserData = nullptr);
+    #endif
+
+        //! Statistics
+        /*----------------*/ void getStats(Stats& pOut);
+        /*----------------*/ void resetStats();
+        /*----------------*/ void dumpStats(std::ostream& pStream);
+        /*----------------*/ void dumpStats(StatsCallback pCallback, void* pUserData = nullptr);
+
+        //! Getters
+        /*----------------*/ inline bool isDeferringEvents() const { return mEventQueue.isDeferring(); }
+        /*----------------*/ inline bool isSnapshotting() const { return mSnapshotting.load(std::memory_order_acquire); }
+        /*----------------*/ inline std::pmr::memory_resource* getResource() const { return mResource; }
+        /*----------------*/ inline Board* getParent() const { return mParent; }
+        /*----------------*/ inline uint64_t getVersion() const { return mVersion.load(std::memory_order_acquire); }
+    };
+
+    namespace Templates {
+        /*
+         *      Name: KeyTable
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the process wide table of interned key strings,
+         *      assigning each unique string a sequential atom ID.
+         *      
+         *      Interned strings are never removed, so the text of a
+         *      Key can be safely referenced from callback events.
+        **/
+        class KeyTable {
+            /*----------Variables----------*/
+
+            //! Store a reader-writer mutex for locking the table when in use
+            SharedRecursiveMutex mLock;
+
+            //! Store the atom IDs of all interned strings
+            KeyMap<uint32_t> mAtoms;
+
+            //! Store the interned strings, indexed by their atom ID
+            std::vector<const std::string*> mTexts;
+
+            //! Store a cached Key of the compile time key cache, the text is set once the slot is filled
+            struct CacheSlot {
+                std::atomic<uint64_t> mHash{ 0 };
+                std::atomic<uint32_t> mID{ 0 };
+                std::atomic<const std::string*> mText{ nullptr };
+            };
+
+            //! Store the Keys of compile time keys by their precomputed hash, searched without locking
+            std::unique_ptr<CacheSlot[]> mCache;
+
+            /*----------Functions----------*/
+
+            //! Privatise the constructor to prevent external use
+            KeyTable() : mCache(new CacheSlot[BLACKBOARD_TYPED_KEY_CACHE]) { static_assert((BLACKBOARD_TYPED_KEY_CACHE & (BLACKBOARD_TYPED_KEY_CACHE - 1)) == 0, "BLACKBOARD_TYPED_KEY_CACHE must be a power of two"); }
+
+        public:
+            //! Retrieve the process wide table
+            static KeyTable& get();
+
+            //! Interning
+            Blackboard::Key intern(std::string_view pKey);
+            Blackboard::Key intern(std::string_view pKey, uint64_t pHash);
+            void intern(const std::vector<std::string>& pKeys, std::vector<Blackboard::Key>& pOut);
+            Blackboard::Key find(std::string_view pKey);
+            Blackboard::Key find(uint32_t pID);
+            void find(const uint32_t* pIDs, size_t pCount, Blackboard::Key* pOut);
+        };
+
+        /*
+         *      Name: CodecTable
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the process wide table of the value types that
+         *      can be saved, identifying each by a stable name so
+         *      that archives can be loaded by other processes.
+         *      
+         *      Registered types are never removed, so the entries
+         *      that are found can be used without locking the table.
+        **/
+        class CodecTable {
+        public:
+            /*
+             *      Name: Entry
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Store the name of a registered type and the
+             *      functions used to save and load its values
+            **/
+            struct Entry {
+                //! Store the name that the type is saved with
+                std::string mName;
+
+                //! Store the type ID of the type
+                size_t mType;
+
+                //! Store the flag that indicates if the values are copied as a block, and the size of each value
+                bool mBlock;
+                uint32_t mSize;
+
+                //! Store the functions that save and load the values of a Value map
+                uint32_t(*mSave)(BaseMap*, ArchiveWriter&);
+                bool(*mLoad)(Blackboard::Board&, ArchiveReader&, uint32_t, const std::vector<Blackboard::Key>&, bool);
+
+                //! Store the functions that save and load the values of a Value map that changed since they were last replicated
+                uint32_t(*mSaveDelta)(BaseMap*, ArchiveWriter&, uint64_t, DeltaBaseline&);
+                bool(*mLoadDelta)(Blackboard::Board&, ArchiveReader&, uint32_t, const std::vector<Blackboard::Key>&, DeltaBaseline&, bool);
+            };
+
+        private:
+            /*----------Variables----------*/
+
+            //! Store a reader-writer mutex for locking the table when in use
+            SharedRecursiveMutex mLock;
+
+            //! Store the registered types by their name
+            KeyMap<Entry> mNames;
+
+            //! Store the registered types, indexed by their type ID
+            std::vector<const Entry*> mTypes;
+
+            /*----------Functions----------*/
+
+            //! Privatise the constructor to prevent external use
+            CodecTable() = default;
+
+        public:
+            //! Retrieve the process wide table
+            static CodecTable& get();
+
+            //! Registration
+            bool add(Entry pEntry);
+            const Entry* find(size_t pType);
+            const Entry* find(std::string_view pName);
+        };
+
+        /*
+         *      Name: Teardown
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Destroy a Board, and the memory pool that it allocates
+         *      from, on a background thread so that the thread that
+         *      releases it isn't held up freeing its values.
+         *      
+         *      One teardown runs at a time, starting another waits
+         *      for the previous one to finish. The thread is joined
+         *      when the process exits.
+        **/
+        class Teardown {
+            /*----------Variables----------*/
+
+            //! Store the thread that is destroying a Board
+            std::thread mThread;
+
+            //! Store a mutex for locking the thread when in use
+            std::mutex mLock;
+
+            /*----------Functions----------*/
+
+            //! Privatise the constructor to prevent external use
+            Teardown() = default;
+
+        public:
+            //! Destructor
+            ~Teardown() { wait(); }
+
+            //! Retrieve the process wide teardown thread
+            static Teardown& get();
+
+            //! Teardown management
+            void run(Blackboard::Board* pBoard, std::pmr::memory_resource* pPool);
+            void wait();
+        };
+
+        /*
+         *      Name: BaseBatch
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Provide a base point for the writes of each type that
+         *      are collected by a Batch, so that they can be applied
+         *      without the Batch knowing their types.
+        **/
+        class BaseBatch {
+        protected:
+            //! Set the Batch to be a friend to allow for construction/destruction of the object
+            friend class Utilities::Blackboard::Batch;
+
+            //! Store the type ID of the values that are written
+            const size_t mType;
+
+            //! Privatise the constructor to prevent external use
+            explicit BaseBatch(size_t pType) : mType(pType) {}
+
+        public:
+            //! Destructor
+            virtual ~BaseBatch() {}
+
+            //! Provide virtual methods for applying and counting the writes
+            inline virtual size_t apply(Blackboard::Board& pBoard, bool pRaiseCallbacks) = 0;
+            inline virtual size_t size() const = 0;
+        };
+
+        /*
+         *      Name: ValueBatch
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store the writes of a single type that are collected
+         *      by a Batch, in the order that they were made
+        **/
+        template<typename T>
+        class ValueBatch : public BaseBatch {
+            //! Set the Batch to be a friend to allow for construction/destruction of the object
+            friend class Utilities::Blackboard::Batch;
+
+            /*----------Variables----------*/
+
+            //! Store the keys and values that have been written
+            std::vector<std::pair<Blackboard::Key, T>> mWrites;
+
+            //! Privatise the constructor to prevent external use
+            explicit ValueBatch(size_t pType) : BaseBatch(pType) {}
+
+        public:
+            //! Apply the writes to a Board, clearing the list
+            inline size_t apply(Blackboard::Board& pBoard, bool pRaiseCallbacks) override { return pBoard.writeBatch<T>(mWrites, pRaiseCallbacks); }
+
+            //! Get the number of writes waiting to be applied
+            inline size_t size() const override { return mWrites.size(); }
+        };
+
+        /*
+         *      Name: BaseMap
+         *      Author: Mitchell Croft
+         *      Created: 08/11/2016
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Provide a base point for the templated ValueMap
+         *      objects to inherit from. This allows the 
+         *      blackboard to store pointers to the templated 
+         *      versions for storing data.
+         *      
+         *      Each of the virtual methods is responsible for
+         *      locking the data that it modifies.
+        **/
+        class BaseMap { 
+        protected:
+            //! Set the Value map to be a friend of the blackboard to allow for construction/destruction of the object
+            friend class Utilities::Blackboard;
+
+            //! Set the Board to be a friend to allow for construction/destruction of the object
+            friend class Utilities::Blackboard::Board;
+
+            //! Store the queue that deferred event notifications are added to
+            EventQueue* mQueue;
+
+            //! Store the counter of the owning Board that is incremented every time a key gains a value
+            std::atomic<size_t>* mLayout;
+
+            //! Store the flag of the owning Board that indicates if changed keys are tracked for snapshots
+            const std::atomic<bool>* mSnapshotting;
+
+            //! Store the current version of the owning Board that changes are stamped with
+            const std::atomic<uint64_t>* mVersion;
+
+            //! Store the index of the owning Board that lists the types holding each key, and the type ID of the map
+            TypeIndex* mIndex;
+            const uint32_t mType;
+
+            //! Store the memory resource that the map and its containers are allocated from
+            std::pmr::memory_resource* mResource;
+
+            //! Privatise the constructor/destructor to prevent external use
+            BaseMap(EventQueue* pQueue, std::atomic<size_t>* pLayout, const std::atomic<bool>* pSnapshotting, const std::atomic<uint64_t>* pVersion, TypeIndex* pIndex, uint32_t pType, std::pmr::memory_resource* pResource) : mQueue(pQueue), mLayout(pLayout), mSnapshotting(pSnapshotting), mVersion(pVersion), mIndex(pIndex), mType(pType), mResource(pResource) {}
+            virtual ~BaseMap() = 0; 
+
+            //! Destroy the map and return its memory to the resource it was allocated from
+            inline virtual void release() = 0;
+
+            //! Provide virtual methods for wiping keyed information
+            inline virtual void wipeKey(const Blackboard::Key& pKey) = 0;
+            inline virtual void wipeAll(bool pWipeCallbacks) = 0;
+            inline virtual void unsubscribe(const Blackboard::Key& pKey) = 0;
+            inline virtual void removeSubscriber(const Blackboard::Key& pKey, uint32_t pID) = 0;
+
+            //! Provide a virtual method for raising the events of a deferred notification
+            inline virtual void raisePending(const Blackboard::Key& pKey) = 0;
+
+            //! Provide a virtual method for erasing a value once its lifetime has ended
+            inline virtual bool expire(uint32_t pID, uint64_t pDeadline, bool pRaiseCallbacks) = 0;
+
+            //! Provide virtual methods for bringing a snapshot buffer up to date
+            inline virtual const void* publish(size_t pBuffer) = 0;
+            inline virtual void invalidateSnapshots() = 0;
+
+            //! Provide a virtual method for finding the keys that have changed
+            inline virtual void changedSince(uint64_t pVersion, std::vector<Blackboard::Key>& pOut) = 0;
+
+        #ifdef BLACKBOARD_STATS
+            //! Store the access statistics of the value type
+            TypeStats mStats;
+
+            //! Provide virtual methods for collecting and resetting the statistics of each key
+            inline virtual void collectStats(std::vector<Blackboard::Stats::KeyAccess>& pOut) = 0;
+            inline virtual void resetStats() = 0;
+        #endif
+        };
+
+        //! Define the default destructor for the BaseMap's pure virtual destructor
+        inline BaseMap::~BaseMap() {}
+
+        /*
+         *      Name: ThreadRunner
+         *      Author: Mitchell Croft
+         *      Created: 14/10/2026
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Run a number of tasks across a set of threads, for
+         *      use by a parallel for-each when no job system is
+         *      supplied. Each thread takes the next task that hasn't
+         *      been run until none are left, the calling thread
+         *      being one of them.
+         *      
+         *      Warning:
+         *      The threads are created and joined on every call.
+        **/
+        struct ThreadRunner {
+            template<typename TTask>
+            inline void operator()(size_t pCount, TTask&& pTask) const {
+                //Find the number of threads to use
+                const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+                const size_t threads = std::min(pCount, hardware);
+                if (!threads) return;
+
+                //Take tasks on each thread until they have all been started, so that uneven tasks are balanced
+                std::atomic<size_t> next{ 0 };
+                auto worker = [&pTask, &next, pCount]() { for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < pCount;) pTask(i); };
+                std::vector<std::thread> started;
+                started.reserve(threads - 1);
+                for (size_t i = 1; i < threads; i++) started.emplace_back(worker);
+                worker();
+                for (std::thread& thread : started) thread.join();
+            }
+        };
+
+        /*
+         *      Name: ValueMap (General)
+         *      Author: Mitchell Croft
+         *      Created: 08/11/2016
+         *      Modified: 14/10/2026
+         *      
+         *      Purpose:
+         *      Store templated data type information for recollection
+         *      and use within the Blackboard singleton object
+         *      
+         *      Keys are distributed across a number of stripes by
+         *      their atom ID, each with its own lock and map of key
+         *      records. The containers used by each stripe are
+         *      defined by the TStorage policy.
+        **/
+        template<typename T, typename TStorage>
+        class ValueMap : BaseMap {
+        protected:
+            //! Set the Value map to be a friend of the blackboard to allow for construction/destruction of the object
+            friend class Utilities::Blackboard;
+
+            //! Set the Board to be a friend to allow for construction/destruction of the object
+            friend class Utilities::Blackboard::Board;
+
+            //! Set the Handle to be a friend to allow it to store the record it resolves to
+            friend class Utilities::Blackboard::Handle<T>;
+
+        #ifdef BLACKBOARD_COROUTINES
+            //! Set the key change awaiter to be a friend to allow it to wait on keys
+            friend class Utilities::Blackboard::Changed<T>;
+        #endif
+
+            //! Define the key types that refer to values stored in this map
+            typedef Utilities::Blackboard::Key Key;
+            typedef Utilities::Blackboard::Handle<T> Handle;
+
+            /*
+             *      Name: Subscriber
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Store a single callback event that is subscribed
+             *      to a key, along with its user data
+            **/
+            struct Subscriber {
+                //! Define the different types of callback that can be stored
+                enum class EType : uint8_t { Key, Value, Pair, KeyContext, ValueContext, PairContext };
+
+                //! Store the callback function
+                union {
+                    EventKeyCallback<T> mKeyCb;
+                    EventValueCallback<T> mValueCb;
+                    EventKeyValueCallback<T> mPairCb;
+                    EventKeyContextCallback<T> mKeyContextCb;
+                    EventValueContextCallback<T> mValueContextCb;
+                    EventKeyValueContextCallback<T> mPairContextCb;
+                };
+
+                //! Store the user data that is passed to context callbacks
+                void* mUserData;
+
+                //! Store the ID of the subscriber within its key's list
+                uint32_t mID;
+
+                //! Store the type of callback that is stored
+                EType mType;
+
+                //! Construct a subscriber without a callback
+                Subscriber(EType pType, void* pUserData) : mKeyCb(nullptr), mUserData(pUserData), mID(0), mType(pType) {}
+
+                //! Create subscribers for each of the callback types, these are named as some of the callback types are identical when T is std::string
+                static inline Subscriber createKey(EventKeyCallback<T> pCb) { Subscriber subscriber(EType::Key, nullptr); subscriber.mKeyCb = pCb; return subscriber; }
+                static inline Subscriber createValue(EventValueCallback<T> pCb) { Subscriber subscriber(EType::Value, nullptr); subscriber.mValueCb = pCb; return subscriber; }
+                static inline Subscriber createPair(EventKeyValueCallback<T> pCb) { Subscriber subscriber(EType::Pair, nullptr); subscriber.mPairCb = pCb; return subscriber; }
+                static inline Subscriber createKeyContext(EventKeyContextCallback<T> pCb, void* pUserData) { Subscriber subscriber(EType::KeyContext, pUserData); subscriber.mKeyContextCb = pCb; return subscriber; }
+                static inline Subscriber createValueContext(EventValueContextCallback<T> pCb, void* pUserData) { Subscriber subscriber(EType::ValueContext, pUserData); subscriber.mValueContextCb = pCb; return subscriber; }
+                static inline Subscriber createPairContext(EventKeyValueContextCallback<T> pCb, void* pUserData) { Subscriber subscriber(EType::PairContext, pUserData); subscriber.mPairContextCb = pCb; return subscriber; }
+
+                //! Check if the callback needs the value that was written
+                inline bool needsValue() const { return (mType != EType::Key && mType != EType::KeyContext); }
+
+                //! Raise the callback event
+                inline void raise(const std::string& pKey, const T* pValue) const;
+            };
+
+            //! Define the list type used to store the subscribers of a key
+            typedef SmallVector<Subscriber, BLACKBOARD_INLINE_SUBSCRIBERS> SubscriberList;
+
+            /*
+             *      Name: Record
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Store everything that is known about a single key,
+             *      so that writing a value and raising its callback
+             *      events only needs one lookup. A record exists while
+             *      the key has either a value or subscribers.
+            **/
+            struct Record {
+                //! Store the value of the key, this is empty if the key only has subscribers
+                std::optional<T> mValue;
+
+                //! Store the subscribers of the key, this is null if the key has no listeners
+                std::unique_ptr<SubscriberList> mSubscribers;
+
+                //! Store the flag that indicates if a deferred notification is waiting to be raised
+                bool mPending = false;
+
+                //! Store the flag that indicates if the key has been added to the type index of the Board
+                bool mIndexed = false;
+
+                //! Store the snapshot frame of the stripe that the key was last listed as changed in
+                uint32_t mChangedFrame = 0;
+
+                //! Store the version of the Board that the key last changed in, this is 0 if it has never changed
+                uint64_t mVersion = 0;
+
+                //! Store the time on the Board's timer wheel that the value expires at, this is 0 if it doesn't expire
+                uint64_t mExpiry = 0;
+
+            #ifdef BLACKBOARD_STATS
+                //! Store the number of times the key has been read and written
+                KeyStats mStats;
+            #endif
+            };
+
+            //! Store a key that changed and the version of the Board that it changed in
+            struct Change {
+                uint64_t mVersion;
+                uint32_t mID;
+            };
+
+            //! Define the map type used to store the records of a stripe
+            typedef typename TStorage::template Map<Record> RecordMap;
+
+            /*
+             *      Name: Stripe
+             *      Author: Mitchell Croft
+             *      Created: 14/10/2026
+             *      Modified: 14/10/2026
+             *
+             *      Purpose:
+             *      Store the subset of the keyed records that are
+             *      guarded by a single lock
+            **/
+            struct Stripe {
+                //! Construct the stripe with the memory resource used by its records
+                explicit Stripe(std::pmr::memory_resource* pResource) : mRecords(pResource), mChanged(pResource), mPreviousChanged(pResource), mLog(pResource) {}
+
+                //! Store a reader-writer mutex for locking the stripe when in use
+                SharedRecursiveMutex mLock;
+
+                //! Store a map of the key records for this stripe
+                RecordMap mRecords;
+
+                //! Store the ID that will be given to the next subscriber
+                uint32_t mNextSubscriber = 1;
+
+                //! Store the number of records in this stripe that have subscribers
+                size_t mListened = 0;
+
+                //! Store a counter that is incremented every time values are erased from the stripe
+                size_t mGeneration = 0;
+
+                //! Store the keys that have changed since the last publish, and in the frame before it
+                std::pmr::vector<uint32_t> mChanged;
+                std::pmr::vector<uint32_t> mPreviousChanged;
+
+                //! Store the number of the current snapshot frame of the stripe
+                uint32_t mFrame = 1;
+
+                //! Store the changes made to the keys of the stripe in version order, and the size that the log is compacted at
+                std::pmr::vector<Change> mLog;
+                size_t mCompactAt = 64;
+
+            #ifdef BLACKBOARD_COROUTINES
+                //! Store the coroutines waiting for each key of the stripe to change, by atom ID
+                std::pmr::unordered_map<uint32_t, KeyWaiter*> mWaiters{ mLog.get_allocator().resource() };
+            #endif
+            };
+
+            /*----------Variables----------*/
+
+            //! Store the stripes that the keys are distributed across
+            std::array<Stripe, BLACKBOARD_STRIPE_COUNT> mStripes;
+
+            //! Store the double buffered snapshots of the values
+            FlatMap<T> mSnapshots[2];
+
+            //! Store the number of publishes that must rebuild their buffer from every value
+            std::atomic<uint8_t> mRebuild;
+
+            //! Store the shared region that the values are mirrored into and the name of their type, the region is nullptr if they aren't shared
+            std::atomic<Blackboard::SharedRegion*> mShared;
+            const std::string* mSharedType;
+
+            /*----------Functions----------*/
+
+            //! Privatise the constructor/destructor to prevent external use
+            ValueMap(EventQueue* pQueue, std::atomic<size_t>* pLayout, const std::atomic<bool>* pSnapshotting, const std::atomic<uint64_t>* pVersion, TypeIndex* pIndex, uint32_t pType, std::pmr::memory_resource* pResource) : BaseMap(pQueue, pLayout, pSnapshotting, pVersion, pIndex, pType, pResource), mStripes(createStripes(pResource, std::make_index_sequence<BLACKBOARD_STRIPE_COUNT>())), mSnapshots{ FlatMap<T>(pResource), FlatMap<T>(pResource) }, mRebuild(2), mShared(nullptr), mSharedType(nullptr) { BLACKBOARD_STAT(for (Stripe& stripe : mStripes) stripe.mLock.setStats(&mStats.mLock);) }
+            ~ValueMap() override {}
+
+            //! Construct each of the stripes with the memory resource
+            template<size_t... TIndices> static inline std::array<Stripe, sizeof...(TIndices)> createStripes(std::pmr::memory_resource* pResource, std::index_sequence<TIndices...>) { return {{ ((void)TIndices, Stripe(pResource))... }}; }
+
+            //! Destroy the map and return its memory to the resource
+            inline void release() override;
+
+            //! Find the stripe that a key value belongs to
+            inline size_t stripeIndex(const Key& pKey) const { return pKey.getID() % BLACKBOARD_STRIPE_COUNT; }
+
+            //! Get the generation of a stripe, which changes whenever its values are erased or moved
+            inline size_t getGeneration(Stripe& pStripe) const { return pStripe.mGeneration + TStorage::relocations(pStripe.mRecords); }
+
+            //! Get the value of a record, default constructing it if the record doesn't have one
+            inline T& ensureValue(Record& pRecord) { return (pRecord.mValue ? *pRecord.mValue : constructValue(pRecord)); }
+
+            //! Assign a value to a record, constructing it if the record doesn't have one
+            template<typename TArg> inline T& storeValue(Record& pRecord, TArg&& pValue);
+
+            //! Construct the value of a record that doesn't have one
+            template<typename... TArgs> inline T& constructValue(Record& pRecord, TArgs&&... pArgs);
+
+            //! Data reading/writing
+            inline void write(const Key& pKey, const T& pValue, bool pRaiseCallbacks);
+            inline void write(const Key& pKey, const T& pValue, uint64_t pLifetime, TimerWheel& pTimers, bool pRaiseCallbacks);
+            inline const T& read(const Key& pKey);
+            inline bool tryRead(const Key& pKey, T& pOut);
+            inline const T* find(const Key& pKey);
+            inline void write(const Key& pKey, T&& pValue, bool pRaiseCallbacks);
+            template<typename... TArgs> inline void emplace(const Key& pKey, TArgs&&... pArgs);
+            template<typename TFunc> inline void modify(const Key& pKey, TFunc& pFunc, bool pRaiseCallbacks);
+            inline void write(Handle& pHandle, const T& pValue, bool pRaiseCallbacks);
+            inline void write(Handle& pHandle, T&& pValue, bool pRaiseCallbacks);
+            template<typename TFunc> inline void modify(Handle& pHandle, TFunc& pFunc, bool pRaiseCallbacks);
+            inline const T& read(Handle& pHandle);
+            inline const T* find(Handle& pHandle);
+            inline void find(const Key* pKeys, size_t pCount, const T** pOut);
+            inline void writeBatch(std::vector<std::pair<Key, T>>& pWrites, bool pRaiseCallbacks);
+
+            //! Bulk iteration over the values of a part of a single stripe
+            template<typename TFunc> inline size_t forEach(size_t pStripe, size_t pPart, size_t pPartCount, TFunc& pFunc);
+
+            //! Ensure that a Handle is pointing at the current record for its key
+            inline Record& resolveSlot(Stripe& pStripe, Handle& pHandle);
+
+            //! Unlock a stripe and raise the callback events that are associated with a key value
+            inline void raiseEvents(std::unique_lock<SharedRecursiveMutex>& pGuard, Record& pRecord, const Key& pKey);
+            inline void dispatchEvents(std::unique_lock<SharedRecursiveMutex>& pGuard, const SubscriberList& pSubscribers, const Key& pKey, const T& pValue);
+
+            //! Callback event assignment
+            inline uint32_t addSubscriber(const Key& pKey, Subscriber pSubscriber);
+            inline void releaseSubscribers(Stripe& pStripe, uint32_t pID, Record& pRecord);
+
+            //! Override the functions used to remove keyed information
+            inline void wipeKey(const Key& pKey) override;
+            inline void wipeAll(bool pWipeCallbacks) override;
+            inline void unsubscribe(const Key& pKey) override;
+            inline void removeSubscriber(const Key& pKey, uint32_t pID) override;
+
+            //! Override the function used to raise deferred events
+            inline void raisePending(const Key& pKey) override;
+
+            //! Override the function used to erase values once their lifetime has ended
+            inline bool expire(uint32_t pID, uint64_t pDeadline, bool pRaiseCallbacks) override;
+
+            //! Stamp a key with the current version and list it as changed for the next snapshot publish
+            inline void trackChange(Stripe& pStripe, Record& pRecord, uint32_t pID);
+
+            //! Remove the changes from the log of a stripe that have been superseded
+            inline void compactLog(Stripe& pStripe);
+
+            //! Add a key to the type index of the Board the first time its record is used
+            inline void indexKey(Record& pRecord, uint32_t pID) { if (!pRecord.mIndexed) { pRecord.mIndexed = true; mIndex->add(pID, mType); } }
+
+            //! Copy the value of a record into the shared region, or remove it once the value is erased
+            inline void mirrorValue(const Record& pRecord, uint32_t pID);
+            inline void eraseMirror(uint32_t pID);
+
+            //! Mirror the values into a shared region
+            inline bool share(Blackboard::SharedRegion* pRegion, const std::string* pType);
+
+            //! Count the reads and writes of a record, these are only recorded when BLACKBOARD_STATS is defined
+            inline void countRead(Record& pRecord) { BLACKBOARD_STAT(pRecord.mStats.mReads.add(); mStats.mReads.add();) (void)pRecord; }
+            inline void countWrite(Record& pRecord) { BLACKBOARD_STAT(pRecord.mStats.mWrites.add(); mStats.mWrites.add();) (void)pRecord; }
+
+            //! Override the functions used to maintain the snapshot buffers
+            inline const void* publish(size_t pBuffer) override;
+            inline void invalidateSnapshots() override { mRebuild.store(2, std::memory_order_release); }
+
+            //! Override the function used to find the keys that have changed
+            inline void changedSince(uint64_t pVersion, std::vector<Key>& pOut) override;
+
+            //! Get the version that a key last changed in
+            inline uint64_t getVersion(const Key& pKey);
+
+            //! Serialisation
+            inline uint32_t save(ArchiveWriter& pWriter);
+            inline bool load(ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, bool pRaiseCallbacks);
+
+            //! Replication
+            inline uint32_t saveDelta(ArchiveWriter& pWriter, uint64_t pVersion, DeltaBaseline& pBaseline);
+            inline bool loadDelta(ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, DeltaBaseline& pBaseline, bool pRaiseCallbacks);
+
+        #ifdef BLACKBOARD_COROUTINES
+            //! Coroutine waiters
+            inline void addWaiter(const Key& pKey, KeyWaiter& pWaiter);
+            inline void removeWaiter(const Key& pKey, KeyWaiter& pWaiter);
+            inline KeyWaiter* takeWaiters(Stripe& pStripe, uint32_t pID, bool pWritten);
+        #endif
+
+        #ifdef BLACKBOARD_STATS
+            //! Override the functions used to collect and reset the statistics of each key
+            inline void collectStats(std::vector<Blackboard::Stats::KeyAccess>& pOut) override;
+            inline void resetStats() override;
+        #endif
+        };
+    }
+
+    #pragma region Template Definitions
+    #pragma region Blackboard
+    /*
+        Blackboard : templateToID<T> - Convert the template type T to a unique index
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        return size_t - Returns the ID as a size_t value
+
+        Note: IDs are assigned sequentially from 0 the first time each type is used, so they can
+              index mDataStorage directly without relying on RTTI
+    */
+    template<typename T>
+    inline size_t Utilities::Blackboard::templateToID() {
+        //Assign the type the next available index the first time it is used
+        static const size_t ID = mTypeCounter.fetch_add(1);
+
+        //Return the index
+        return ID;
+    }
+
+    /*
+        Blackboard : write<T> - Write a data value to the Blackboard 
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(std::string_view pKey, const T& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pKey, pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Write a data value to the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(const Key& pKey, const T& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pKey, pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Write a data value to the Blackboard that is erased once a lifetime has passed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pLifetime - The time after the most recent tick that the value expires at
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(std::string_view pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks) { getBoard().write<T>(pKey, pValue, pLifetime, pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Write a data value to the Blackboard using an interned Key that is erased once a
+                                lifetime has passed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pLifetime - The time after the most recent tick that the value expires at
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(const Key& pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks) { getBoard().write<T>(pKey, pValue, pLifetime, pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Move a data value onto the Blackboard
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename>
+    inline void Utilities::Blackboard::write(std::string_view pKey, T&& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pKey, std::move(pValue), pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Move a data value onto the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename>
+    inline void Utilities::Blackboard::write(const Key& pKey, T&& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pKey, std::move(pValue), pRaiseCallbacks); }
+
+    /*
+        Blackboard : emplace<T> - Construct a data value in place on the Blackboard
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pKey - The key value to construct the data value at
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+
+        Note: If the key already holds a value, a new value is constructed and move assigned over it.
+              Callback events are always raised
+    */
+    template<typename T, typename... TArgs>
+    inline void Utilities::Blackboard::emplace(std::string_view pKey, TArgs&&... pArgs) { getBoard().emplace<T>(pKey, std::forward<TArgs>(pArgs)...); }
+
+    /*
+        Blackboard : emplace<T> - Construct a data value in place on the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pKey - The key value to construct the data value at
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+
+        Note: If the key already holds a value, a new value is constructed and move assigned over it.
+              Callback events are always raised
+    */
+    template<typename T, typename... TArgs>
+    inline void Utilities::Blackboard::emplace(const Key& pKey, TArgs&&... pArgs) { getBoard().emplace<T>(pKey, std::forward<TArgs>(pArgs)...); }
+
+    /*
+        Blackboard : modify<T> - Modify the value stored at a key in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pKey - The key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::modify(std::string_view pKey, TFunc&& pFunc, bool pRaiseCallbacks) { getBoard().modify<T>(pKey, std::forward<TFunc>(pFunc), pRaiseCallbacks); }
+
+    /*
+        Blackboard : modify<T> - Modify the value stored at an interned Key in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pKey - The key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::modify(const Key& pKey, TFunc&& pFunc, bool pRaiseCallbacks) { getBoard().modify<T>(pKey, std::forward<TFunc>(pFunc), pRaiseCallbacks); }
+
+    /*
+        Blackboard : read<T> - Read the value of a key value from the Blackboard
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::read(std::string_view pKey) { return getBoard().read<T>(pKey); }
+
+    /*
+        Blackboard : read<T> - Read the value of a key value from the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::read(const Key& pKey) { return getBoard().read<T>(pKey); }
+
+    /*
+        Blackboard : tryRead<T> - Copy the value of a key value from the Blackboard if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+
+        Note: A missing key, value or type will not allocate or modify the Blackboard
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::tryRead(std::string_view pKey, T& pOut) { return getBoard().tryRead<T>(pKey, pOut); }
+
+    /*
+        Blackboard : tryRead<T> - Copy the value of a key value from the Blackboard if it exists using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+
+        Note: A missing value or type will not allocate or modify the Blackboard
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::tryRead(const Key& pKey, T& pOut) { return getBoard().tryRead<T>(pKey, pOut); }
+
+    /*
+        Blackboard : find<T> - Find the value of a key value on the Blackboard if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+
+        Note: A missing key, value or type will not allocate or modify the Blackboard. The returned
+              pointer remains valid until the key is wiped, or when the type is held with
+              Templates::FlatStorage, only until a new key is added to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::find(std::string_view pKey) { return getBoard().find<T>(pKey); }
+
+    /*
+        Blackboard : find<T> - Find the value of a key value on the Blackboard if it exists using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+
+        Note: A missing value or type will not allocate or modify the Blackboard. The returned
+              pointer remains valid until the key is wiped, or when the type is held with
+              Templates::FlatStorage, only until a new key is added to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::find(const Key& pKey) { return getBoard().find<T>(pKey); }
+
+    /*
+        Blackboard : getHandle<T> - Retrieve a Handle that can be used to repeatedly read and write a key value
+                                    without looking it up each time
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value that the Handle will refer to
+
+        return Handle<T> - Returns a Handle object for the key value
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::getHandle(std::string_view pKey) { return getBoard().getHandle<T>(pKey); }
+
+    /*
+        Blackboard : getHandle<T> - Retrieve a Handle that can be used to repeatedly read and write an interned
+                                    Key without looking it up each time
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value that the Handle will refer to
+
+        return Handle<T> - Returns a Handle object for the key value
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::getHandle(const Key& pKey) { return getBoard().getHandle<T>(pKey); }
+
+    /*
+        Blackboard : write<T> - Write a data value to the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(Handle<T>& pHandle, const T& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pHandle, pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard : write<T> - Move a data value onto the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(Handle<T>& pHandle, T&& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pHandle, std::move(pValue), pRaiseCallbacks); }
+
+    /*
+        Blackboard : modify<T> - Modify the value stored at the key of a pre-resolved Handle in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pHandle - The Handle to the key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::modify(Handle<T>& pHandle, TFunc&& pFunc, bool pRaiseCallbacks) { getBoard().modify<T>(pHandle, std::forward<TFunc>(pFunc), pRaiseCallbacks); }
+
+    /*
+        Blackboard : read<T> - Read the value of a key value from the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::read(Handle<T>& pHandle) { return getBoard().read<T>(pHandle); }
+
+    /*
+        Blackboard : wipeTypeKey - Wipe the value stored at a specific key for the specified type
+        Author: Mitchell Croft
+        Created: 09/11/2016
+        Modified: 14/10/2026
+
+        param[in] pKey - A string object containing the key of the value(s) to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::wipeTypeKey(std::string_view pKey) { getBoard().wipeTypeKey<T>(pKey); }
+
+    /*
+        Blackboard : wipeTypeKey - Wipe the value stored at a specific interned Key for the specified type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pKey - The Key of the value to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::wipeTypeKey(const Key& pKey) { getBoard().wipeTypeKey<T>(pKey); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference as its only parameter
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventKeyCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference as its only parameter
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventKeyCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventValueCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventValueCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and a constant reference to
+                        the new value as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventKeyValueCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and a constant reference to
+                        the new value as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventKeyValueCallback<T> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventKeyContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventKeyContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventValueContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventValueContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference, a constant reference to
+                        the new value and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(std::string_view pKey, EventKeyValueContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference, a constant reference to
+                        the new value and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const Key& pKey, EventKeyValueContextCallback<T> pCb, void* pUserData) { return getBoard().subscribe<T>(pKey, pCb, pUserData); }
+
+    /*
+        Blackboard : unsubscribe - Unsubscribe all events associated with a key value
+                                   for a specific type
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        param[in] pKey - The key to remove the callback events from
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::unsubscribe(std::string_view pKey) { getBoard().unsubscribe<T>(pKey); }
+
+    /*
+        Blackboard : unsubscribe - Unsubscribe all events associated with an interned Key
+                                   for a specific type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pKey - The key to remove the callback events from
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::unsubscribe(const Key& pKey) { getBoard().unsubscribe<T>(pKey); }
+
+    /*
+        Blackboard : write<T> - Write a value to a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to save the data value at
+        param[in] pValue - The data value to be saved, converted to the type of the key
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::write(const TypedKey<T>& pKey, const typename TypedKey<T>::Type& pValue, bool pRaiseCallbacks) { getBoard().write<T>(pKey, pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard : read<T> - Read the value of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to read the data value of
+
+        return const T& - Returns a constant reference to the value of the key
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::read(const TypedKey<T>& pKey) { return getBoard().read<T>(pKey); }
+
+    /*
+        Blackboard : tryRead<T> - Copy the value of a compile time key if it exists on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to read the data value of
+        param[out] pOut - The object that the value is copied into if it exists
+
+        return bool - Returns true if the key had a value
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::tryRead(const TypedKey<T>& pKey, T& pOut) { return getBoard().tryRead<T>(pKey, pOut); }
+
+    /*
+        Blackboard : find<T> - Find the value of a compile time key without creating it on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to find the data value of
+
+        return const T* - Returns a pointer to the value, or nullptr if the key has no value
+
+        Note: When the type is held with Templates::FlatStorage the returned pointer is invalidated
+              by adding a new key to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::find(const TypedKey<T>& pKey) { return getBoard().find<T>(pKey); }
+
+    /*
+        Blackboard : getHandle<T> - Retrieve a Handle to the value slot of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to retrieve the Handle for
+
+        return Handle<T> - Returns a Handle that resolves its slot when it is first used
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::getHandle(const TypedKey<T>& pKey) { return getBoard().getHandle<T>(pKey); }
+
+    /*
+        Blackboard : modify<T> - Modify the value of a compile time key in place on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+        template TFunc - A function that takes a T& as its only parameter
+
+        param[in] pKey - The key of the value to modify
+        param[in] pFunc - The function that is given a reference to the value, default constructing it if needed
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::modify(const TypedKey<T>& pKey, TFunc&& pFunc, bool pRaiseCallbacks) { getBoard().modify<T>(pKey, std::forward<TFunc>(pFunc), pRaiseCallbacks); }
+
+    /*
+        Blackboard : wipeTypeKey<T> - Wipe the value stored at a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key of the value to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::wipeTypeKey(const TypedKey<T>& pKey) { getBoard().wipeTypeKey<T>(pKey); }
+
+    /*
+        Blackboard : subscribe<T> - Subscribe a key callback to the changes of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the key that changed
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const TypedKey<T>& pKey, EventKeyCallback<typename TypedKey<T>::Type> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Subscribe a value callback to the changes of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the new value of the key
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const TypedKey<T>& pKey, EventValueCallback<typename TypedKey<T>::Type> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : subscribe<T> - Subscribe a key and value callback to the changes of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the key that changed and its new value
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::subscribe(const TypedKey<T>& pKey, EventKeyValueCallback<typename TypedKey<T>::Type> pCb) { return getBoard().subscribe<T>(pKey, pCb); }
+
+    /*
+        Blackboard : unsubscribe<T> - Remove all of the callback events of a compile time key on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to remove the callback events of
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::unsubscribe(const TypedKey<T>& pKey) { getBoard().unsubscribe<T>(pKey); }
+
+    /*
+        Blackboard : find<T> - Find the values of a list of interned Keys on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKeys - The keys to find the values of
+        param[in] pCount - The number of keys in the list
+        param[out] pOut - The list that a pointer to each value, or nullptr if it doesn't exist, is stored in
+
+        Note: When the type is held with Templates::FlatStorage the returned pointers are invalidated
+              by adding a new key to the same stripe
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::find(const Key* pKeys, size_t pCount, const T** pOut) { getBoard().find<T>(pKeys, pCount, pOut); }
+
+    /*
+        Blackboard : getVersion<T> - Get the version of the singleton Board that a key value last changed in
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to get the version of
+
+        return uint64_t - Returns the version, or 0 if the key has never changed
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::getVersion(std::string_view pKey) { return getBoard().getVersion<T>(pKey); }
+
+    /*
+        Blackboard : getVersion<T> - Get the version of the singleton Board that a key value last changed in using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to get the version of
+
+        return uint64_t - Returns the version, or 0 if the key has never changed
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::getVersion(const Key& pKey) { return getBoard().getVersion<T>(pKey); }
+
+    /*
+        Blackboard : changedSince<T> - Find the keys of a type that have changed on the singleton Board since a version
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pVersion - The first version to include the changes of, 0 includes every change
+        param[out] pOut - The list that the keys that changed are appended to
+
+        return uint64_t - Returns the version to pass to the next call
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::changedSince(uint64_t pVersion, std::vector<Key>& pOut) { return getBoard().changedSince<T>(pVersion, pOut); }
+
+    /*
+        Blackboard : forEach<T> - Call a function with every value of a type on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+
+        param[in] pFunc - The function to call with each of the values
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: The function is called while a stripe of the type is share locked, and the lock can't be
+              re-entered by the visiting thread. It must not call anything that locks values of the type
+              being swept, including reading, finding, writing or wiping them, wiping keys or the Board,
+              publish and save. Values of other types can be read and written
+    */
+    template<typename T, typename TFunc>
+    inline size_t Utilities::Blackboard::forEach(TFunc&& pFunc) { return getBoard().forEach<T>(std::forward<TFunc>(pFunc)); }
+
+    /*
+        Blackboard : forEachParallel<T> - Call a function with every value of a type on the singleton Board,
+                                          spreading the stripes across a set of threads
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+
+        param[in] pFunc - The function to call with each of the values, from any of the threads at once
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: Threads are created and joined on every call, a job system should be passed to the other
+              overload when sweeps are made often. The function has the same restrictions as for forEach,
+              it must not call anything that locks values of the type being swept
+    */
+    template<typename T, typename TFunc>
+    inline size_t Utilities::Blackboard::forEachParallel(TFunc&& pFunc) { return getBoard().forEachParallel<T>(std::forward<TFunc>(pFunc)); }
+
+    /*
+        Blackboard : forEachParallel<T> - Call a function with every value of a type on the singleton Board,
+                                          using a job system to run the stripes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+        template TRunner - A function that is callable as void(size_t pCount, Task&& pTask)
+
+        param[in] pFunc - The function to call with each of the values, from any of the threads at once
+        param[in] pRunner - The function that calls the task with each index below the count, returning
+                            once they have all finished
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: The function has the same restrictions as for forEach, it must not call anything that locks
+              values of the type being swept
+    */
+    template<typename T, typename TFunc, typename TRunner>
+    inline size_t Utilities::Blackboard::forEachParallel(TFunc&& pFunc, TRunner&& pRunner) { return getBoard().forEachParallel<T>(std::forward<TFunc>(pFunc), std::forward<TRunner>(pRunner)); }
+
+    /*
+        Blackboard : registerType<T> - Register a value type with the name that it is saved as
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type that is trivially copyable or has a Templates::Codec specialisation
+
+        param[in] pName - The stable name that identifies the type in saved archives
+
+        return bool - Returns true if the type was registered, or false if the type or name is already in use
+
+        Note: Only the values of registered types are saved, types must be registered with the same name
+              in every process that loads the archive
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::registerType(std::string_view pName) {
+        return Templates::CodecTable::get().add({ std::string(pName), templateToID<T>(), Templates::Codec<T>::IsBlock, (uint32_t)sizeof(T), &Board::saveType<T>, &Board::loadType<T>, &Board::saveDeltaType<T>, &Board::loadDeltaType<T> });
+    }
+
+    /*
+        Blackboard : share<T> - Mirror the values of a type on the singleton Board into a shared region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with registerType
+
+        param[in] pRegion - The open region to mirror the values into, or nullptr to stop mirroring them
+
+        return bool - Returns true if the values are being mirrored and all existing values were copied
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::share(SharedRegion* pRegion) { return getBoard().share<T>(pRegion); }
+
+#ifdef BLACKBOARD_COROUTINES
+    /*
+        Blackboard : changed<T> - Create an awaiter that resumes a coroutine when a key of the singleton Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::changed(std::string_view pKey, ResumeCallback pResume, void* pUserData) { return getBoard().changed<T>(pKey, pResume, pUserData); }
+
+    /*
+        Blackboard : changed<T> - Create an awaiter that resumes a coroutine when an interned key of the singleton Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::changed(const Key& pKey, ResumeCallback pResume, void* pUserData) { return getBoard().changed<T>(pKey, pResume, pUserData); }
+
+    /*
+        Blackboard : changed<T> - Create an awaiter that resumes a coroutine when a compile time key of the singleton Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::changed(const TypedKey<T>& pKey, ResumeCallback pResume, void* pUserData) { return getBoard().changed<T>(pKey, pResume, pUserData); }
+#endif
+
+    /*
+        Blackboard : isDeferringEvents - Check if callback events are currently being deferred on the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        return bool - Returns true if callback events are queued until flushEvents is called
+    */
+    inline bool Utilities::Blackboard::isDeferringEvents() { return getBoard().isDeferringEvents(); }
+
+    /*
+        Blackboard : getSnapshot - Retrieve a read only view of the values of the singleton Board at the last publish
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        return Snapshot - Returns the current Snapshot, this is invalid if nothing has been published
+
+        Note: The Snapshot pins its frame until it is released or destroyed, the second publish after it was
+              retrieved waits for that
+    */
+    inline Utilities::Blackboard::Snapshot Utilities::Blackboard::getSnapshot() { return getBoard().getSnapshot(); }
+
+    /*
+        Blackboard : isSnapshotting - Check if the singleton Board is tracking changed keys for snapshots
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        return bool - Returns true if snapshot mode is enabled
+    */
+    inline bool Utilities::Blackboard::isSnapshotting() { return getBoard().isSnapshotting(); }
+
+    /*
+        Blackboard : getVersion - Get the current version of the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        return uint64_t - Returns the version that changes are currently stamped with
+    */
+    inline uint64_t Utilities::Blackboard::getVersion() { return getBoard().getVersion(); }
+
+    /*
+        Blackboard : batch - Create a Batch that collects writes to the singleton Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised when the writes are committed (Default true)
+
+        return Batch - Returns an empty Batch for the singleton Board
+    */
+    inline Utilities::Blackboard::Batch Utilities::Blackboard::batch(bool pRaiseCallbacks) { return getBoard().batch(pRaiseCallbacks); }
+    #pragma endregion
+
+    #pragma region Board
+    /*
+        Blackboard::Board : findType<T> - Find the Value map that holds data of the template type, without creating it
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        return ValueMap<T>* - Returns a pointer to the Value map for the template type T or nullptr if there is none
+    */
+    template<typename T>
+    inline Utilities::Templates::ValueMap<T>* Utilities::Blackboard::Board::findType() {
+        //Get the index for the type
+        size_t key = templateToID<T>();
+
+        //Share the registry with other threads
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+        //Return the map if there is one
+        return (key < mDataStorage.size() ? (Utilities::Templates::ValueMap<T>*)(mDataStorage[key]) : nullptr);
+    }
+
+    /*
+        Blackboard::Board : supportType<T> - Using the type of the template ensure that there is a Value map to support 
+                                   holding data of its type
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        return ValueMap<T>* - Returns a pointer to the Value map for the template type T
+    */
+    template<typename T>
+    inline Utilities::Templates::ValueMap<T>* Utilities::Blackboard::Board::supportType() {
+        //Look for an existing map while sharing the registry with other threads
+        if (Utilities::Templates::ValueMap<T>* existing = findType<T>()) return existing;
+
+        //Get the index for the type
+        size_t key = templateToID<T>();
+
+        //Lock the registry exclusively to add the new map
+        std::lock_guard<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+        //Ensure there is a slot for the type
+        if (key >= mDataStorage.size()) mDataStorage.resize(key + 1, nullptr);
+
+        //If there isn't a entry for the index create a new map from the memory resource
+        Utilities::Templates::BaseMap*& map = mDataStorage[key];
+        if (!map) {
+            void* memory = mResource->allocate(sizeof(Utilities::Templates::ValueMap<T>), alignof(Utilities::Templates::ValueMap<T>));
+            map = new (memory) Utilities::Templates::ValueMap<T>(&mEventQueue, &mLayout, &mSnapshotting, &mVersion, &mTypeIndex, (uint32_t)key, mResource);
+            BLACKBOARD_STAT(map->mStats.mAllocatedBytes.add(sizeof(Utilities::Templates::ValueMap<T>));)
+        }
+
+        //Return the map
+        return (Utilities::Templates::ValueMap<T>*)(map);
+    }
+
+    /*
+        Blackboard::Board : resolveHandle<T> - Ensure that a Handle is pointing at the current Value map for its type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to resolve
+
+        return ValueMap<T>* - Returns a pointer to the Value map that the Handle points to
+    */
+    template<typename T>
+    inline Utilities::Templates::ValueMap<T>* Utilities::Blackboard::Board::resolveHandle(Handle<T>& pHandle) {
+        //Check if the Value Map needs to be re-resolved
+        if (pHandle.mEpoch != mEpoch) {
+            pHandle.mMap = supportType<T>();
+            pHandle.mStripe = pHandle.mMap->stripeIndex(pHandle.mKey);
+            pHandle.mSlot = nullptr;
+            pHandle.mEpoch = mEpoch;
+        }
+
+        //Return the map
+        return pHandle.mMap;
+    }
+
+    /*
+        Blackboard::Board : write<T> - Write a data value to the Blackboard 
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(std::string_view pKey, const T& pValue, bool pRaiseCallbacks) { write(Key(pKey), pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : write<T> - Write a data value to the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(const Key& pKey, const T& pValue, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the value to the Value Map for the type
+        supportType<T>()->write(pKey, pValue, pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : write<T> - Write a data value to the Board that is erased once a lifetime has passed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pLifetime - The time after the most recent tick that the value expires at
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(std::string_view pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks) { write(Key(pKey), pValue, pLifetime, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : write<T> - Write a data value to the Board using an interned Key that is erased once
+                                       a lifetime has passed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pLifetime - The time after the most recent tick that the value expires at
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: Writing to the key again without a lifetime keeps the value until it is wiped
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(const Key& pKey, const T& pValue, std::chrono::milliseconds pLifetime, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the value to the Value Map for the type
+        const uint64_t lifetime = (pLifetime.count() > 0 ? uint64_t(pLifetime.count()) : 0);
+        supportType<T>()->write(pKey, pValue, lifetime, mTimers, pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : write<T> - Move a data value onto the Blackboard
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename>
+    inline void Utilities::Blackboard::Board::write(std::string_view pKey, T&& pValue, bool pRaiseCallbacks) { write(Key(pKey), std::move(pValue), pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : write<T> - Move a data value onto the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename>
+    inline void Utilities::Blackboard::Board::write(const Key& pKey, T&& pValue, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the value to the Value Map for the type
+        supportType<T>()->write(pKey, std::move(pValue), pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : emplace<T> - Construct a data value in place on the Blackboard
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pKey - The key value to construct the data value at
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+
+        Note: If the key already holds a value, a new value is constructed and move assigned over it.
+              Callback events are always raised
+    */
+    template<typename T, typename... TArgs>
+    inline void Utilities::Blackboard::Board::emplace(std::string_view pKey, TArgs&&... pArgs) { emplace<T>(Key(pKey), std::forward<TArgs>(pArgs)...); }
+
+    /*
+        Blackboard::Board : emplace<T> - Construct a data value in place on the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pKey - The key value to construct the data value at
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+
+        Note: If the key already holds a value, a new value is constructed and move assigned over it.
+              Callback events are always raised
+    */
+    template<typename T, typename... TArgs>
+    inline void Utilities::Blackboard::Board::emplace(const Key& pKey, TArgs&&... pArgs) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the arguments to the Value Map for the type
+        supportType<T>()->emplace(pKey, std::forward<TArgs>(pArgs)...);
+    }
+
+    /*
+        Blackboard::Board : modify<T> - Modify the value stored at a key in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pKey - The key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::Board::modify(std::string_view pKey, TFunc&& pFunc, bool pRaiseCallbacks) { modify<T>(Key(pKey), pFunc, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : modify<T> - Modify the value stored at an interned Key in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pKey - The key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::Board::modify(const Key& pKey, TFunc&& pFunc, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the function to the Value Map for the type
+        supportType<T>()->modify(pKey, pFunc, pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : read<T> - Read the value of a key value from the Blackboard
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::Board::read(std::string_view pKey) { return read<T>(Key(pKey)); }
+
+    /*
+        Blackboard::Board : read<T> - Read the value of a key value from the Blackboard using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::Board::read(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Look for the value on this Board and its parents
+        if (mParent) {
+            const T* value = nullptr;
+            if (visitScope<T>(pKey, [&value](const T& pValue) { value = &pValue; })) return *value;
+        }
+
+        //Return the value from the Value Map for the type
+        return supportType<T>()->read(pKey);
+    }
+
+    /*
+        Blackboard::Board : tryRead<T> - Copy the value of a key value from the Blackboard if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+
+        Note: A missing key, value or type will not allocate or modify the Blackboard
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::tryRead(std::string_view pKey, T& pOut) {
+        //Find the interned key without adding it
+        Key key = Templates::KeyTable::get().find(pKey);
+
+        //Copy the value if the key exists
+        return (key.isValid() && tryRead(key, pOut));
+    }
+
+    /*
+        Blackboard::Board : tryRead<T> - Copy the value of a key value from the Blackboard if it exists using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+
+        Note: A missing value or type will not allocate or modify the Blackboard
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::tryRead(const Key& pKey, T& pOut) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Copy the value from this Board or its parents
+        if (mParent) return visitScope<T>(pKey, [&pOut](const T& pValue) { pOut = pValue; });
+
+        //Find the Value Map for the type
+        Utilities::Templates::ValueMap<T>* map = findType<T>();
+
+        //Copy the value from the Value Map
+        return (map && map->tryRead(pKey, pOut));
+    }
+
+    /*
+        Blackboard::Board : find<T> - Find the value of a key value on the Blackboard if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+
+        Note: A missing key, value or type will not allocate or modify the Blackboard. The returned
+              pointer remains valid until the key is wiped, or when the type is held with
+              Templates::FlatStorage, only until a new key is added to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::Board::find(std::string_view pKey) {
+        //Find the interned key without adding it
+        Key key = Templates::KeyTable::get().find(pKey);
+
+        //Find the value if the key exists
+        return (key.isValid() ? find<T>(key) : nullptr);
+    }
+
+    /*
+        Blackboard::Board : find<T> - Find the value of a key value on the Blackboard if it exists using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+
+        Note: A missing value or type will not allocate or modify the Blackboard. The returned
+              pointer remains valid until the key is wiped, or when the type is held with
+              Templates::FlatStorage, only until a new key is added to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::Board::find(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Look for the value on this Board and its parents
+        if (mParent) {
+            const T* value = nullptr;
+            visitScope<T>(pKey, [&value](const T& pValue) { value = &pValue; });
+            return value;
+        }
+
+        //Find the Value Map for the type
+        Utilities::Templates::ValueMap<T>* map = findType<T>();
+
+        //Return the value from the Value Map
+        return (map ? map->find(pKey) : nullptr);
+    }
+
+    /*
+        Blackboard::Board : getHandle<T> - Retrieve a Handle that can be used to repeatedly read and write a key value
+                                    without looking it up each time
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value that the Handle will refer to
+
+        return Handle<T> - Returns a Handle object for the key value
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::Board::getHandle(std::string_view pKey) { return getHandle<T>(Key(pKey)); }
+
+    /*
+        Blackboard::Board : getHandle<T> - Retrieve a Handle that can be used to repeatedly read and write an interned
+                                    Key without looking it up each time
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value that the Handle will refer to
+
+        return Handle<T> - Returns a Handle object for the key value
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::Board::getHandle(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Create the Handle for the key
+        Handle<T> handle(pKey);
+
+        //Resolve the Value Map for the type
+        Utilities::Templates::ValueMap<T>* map = resolveHandle(handle);
+        auto& stripe = map->mStripes[handle.mStripe];
+
+        //Lock the stripe
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(stripe.mLock);
+
+        //If the value already exists point the Handle at its record
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found != stripe.mRecords.end() && found->second.mValue) {
+            handle.mSlot = &found->second;
+            handle.mGeneration = map->getGeneration(stripe);
+        }
+
+        //Return the Handle
+        return handle;
+    }
+
+    /*
+        Blackboard::Board : write<T> - Write a data value to the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(Handle<T>& pHandle, const T& pValue, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pHandle.mKey.isValid());
+
+        //Pass the value to the Value Map for the Handle
+        resolveHandle(pHandle)->write(pHandle, pValue, pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : write<T> - Move a data value onto the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(Handle<T>& pHandle, T&& pValue, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pHandle.mKey.isValid());
+
+        //Pass the value to the Value Map for the Handle
+        resolveHandle(pHandle)->write(pHandle, std::move(pValue), pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : modify<T> - Modify the value stored at the key of a pre-resolved Handle in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pHandle - The Handle to the key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+
+        Note: A default value is created if the key doesn't exist. The function is called with the
+              stripe for the key exclusively locked, so it should not block
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::Board::modify(Handle<T>& pHandle, TFunc&& pFunc, bool pRaiseCallbacks) {
+        //Ensure that the key is valid
+        assert(pHandle.mKey.isValid());
+
+        //Pass the function to the Value Map for the Handle
+        resolveHandle(pHandle)->modify(pHandle, pFunc, pRaiseCallbacks);
+    }
+
+    /*
+        Blackboard::Board : read<T> - Read the value of a key value from the Blackboard through a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The Handle to the key value to read the data value of
+
+        return const T& - Returns a constant reference to the data type of type T
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::Board::read(Handle<T>& pHandle) {
+        //Ensure that the key is valid
+        assert(pHandle.mKey.isValid());
+
+        //If the key isn't held by this Board look for it on the parents
+        if (mParent) {
+            if (const T* local = resolveHandle(pHandle)->find(pHandle)) return *local;
+            const T* value = nullptr;
+            if (visitScope<T>(pHandle.mKey, [&value](const T& pValue) { value = &pValue; })) return *value;
+        }
+
+        //Return the value from the Value Map for the Handle
+        return resolveHandle(pHandle)->read(pHandle);
+    }
+
+    /*
+        Blackboard::Board : wipeTypeKey - Wipe the value stored at a specific key for the specified type
+        Author: Mitchell Croft
+        Created: 09/11/2016
+        Modified: 14/10/2026
+
+        param[in] pKey - A string object containing the key of the value(s) to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::wipeTypeKey(std::string_view pKey) {
+        //Find the interned key without adding it
+        Key key = Templates::KeyTable::get().find(pKey);
+
+        //Wipe the key if it exists
+        if (key.isValid()) wipeTypeKey<T>(key);
+    }
+
+    /*
+        Blackboard::Board : wipeTypeKey - Wipe the value stored at a specific interned Key for the specified type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pKey - The Key of the value to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::wipeTypeKey(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Wipe the key from the value map if the type has been used
+        if (Utilities::Templates::ValueMap<T>* map = findType<T>()) map->wipeKey(pKey);
+    }
+
+    /*
+        Blackboard::Board : addSubscriber<T> - Add a subscriber to the callback events of a key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to add the subscriber to
+        param[in] pSubscriber - The callback event to add
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::addSubscriber(const Key& pKey, const typename Templates::ValueMap<T>::Subscriber& pSubscriber) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Add the subscriber to the Value Map for the type
+        const uint32_t id = supportType<T>()->addSubscriber(pKey, pSubscriber);
+
+        //Return the token for the subscriber
+        return Subscription(pKey, templateToID<T>(), mEpoch, id);
+    }
+
+    /*
+        Blackboard::Board : visitScope<T> - Find a value on this Board or its parents, passing it to a function while it is locked
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A callable type that takes a const T& as its only parameter
+
+        param[in] pKey - The key value to find the data value of
+        param[in] pFunc - The function that is given the value, called with the stripe of the value share locked
+
+        return bool - Returns true if the value was found and passed to pFunc
+
+        Note: The location of values found on a parent Board are cached, repeated reads of the same
+              key check the cached location before searching each of the Boards
+    */
+    template<typename T, typename TFunc>
+    inline bool Utilities::Blackboard::Board::visitScope(const Key& pKey, TFunc&& pFunc) {
+        //Combine the type and key into a single cache index
+        const uint64_t index = ((uint64_t)templateToID<T>() << 32) | pKey.getID();
+
+        //Check for a cached location on a parent Board
+        ScopeEntry entry;
+        bool cached = false;
+        {
+            std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mScopeLock);
+            auto found = mScopeCache.find(index);
+            if (found != mScopeCache.end()) {
+                entry = found->second;
+                cached = true;
+            }
+        }
+
+        //The cached location is valid if none of the Boards in between have gained values and the value hasn't moved
+        if (cached && entry.mLayout == getScopeLayout(entry.mOwner)) {
+            Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)entry.mMap;
+            auto& stripe = map->mStripes[entry.mStripe];
+            std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(stripe.mLock);
+            if (entry.mGeneration == map->getGeneration(stripe)) {
+                pFunc(*(const T*)entry.mValue);
+                return true;
+            }
+        }
+
+        //Search each of the Boards in turn, totalling the layouts of those that don't hold the value
+        size_t layout = 0;
+        for (Board* board = this; board; board = board->mParent) {
+            //Read the layout before searching so that values added during the search invalidate the cache
+            const size_t boardLayout = board->mLayout.load(std::memory_order_acquire);
+
+            //Find the value on the Board
+            if (Utilities::Templates::ValueMap<T>* map = board->findType<T>()) {
+                const size_t stripeIndex = map->stripeIndex(pKey);
+                auto& stripe = map->mStripes[stripeIndex];
+                std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(stripe.mLock);
+                auto found = stripe.mRecords.find(pKey.getID());
+                if (found != stripe.mRecords.end() && found->second.mValue) {
+                    //Pass the value to the function
+                    const T& value = *found->second.mValue;
+                    pFunc(value);
+
+                    //Cache the location of values that are held by a parent
+                    if (board != this) {
+                        entry = ScopeEntry{ board, map, stripeIndex, &value, map->getGeneration(stripe), layout };
+                        guard.unlock();
+                        std::lock_guard<Utilities::Templates::SharedRecursiveMutex> cacheGuard(mScopeLock);
+                        mScopeCache[index] = entry;
+                    }
+                    return true;
+                }
+            }
+
+            //Add the layout of the Board that didn't hold the value
+            layout += boardLayout;
+        }
+
+        //The value doesn't exist on any of the Boards
+        return false;
+    }
+
+    /*
+        Blackboard::Board : getScopeLayout - Sum the layout counters of the Boards from this one up to, but not including, a parent
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pOwner - The parent Board to stop at
+
+        return size_t - Returns the total of the layout counters
+    */
+    inline size_t Utilities::Blackboard::Board::getScopeLayout(const Board* pOwner) const {
+        //Total the layouts of each of the Boards in turn
+        size_t layout = 0;
+        for (const Board* board = this; board && board != pOwner; board = board->mParent)
+            layout += board->mLayout.load(std::memory_order_acquire);
+        return layout;
+    }
+
+    /*
+        Blackboard::Board : saveType<T> - Write the values of a registered type to an archive
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type that has been registered
+
+        param[in] pMap - The Value map of the type
+        param[in] pWriter - The archive that the values are written to
+
+        return uint32_t - Returns the number of values that were written
+    */
+    template<typename T>
+    inline uint32_t Utilities::Blackboard::Board::saveType(Templates::BaseMap* pMap, Templates::ArchiveWriter& pWriter) { return ((Utilities::Templates::ValueMap<T>*)(pMap))->save(pWriter); }
+
+    /*
+        Blackboard::Board : loadType<T> - Read the values of a registered type from an archive onto a Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type that has been registered
+
+        param[in] pBoard - The Board that the values are written to
+        param[in] pReader - The archive that the values are read from
+        param[in] pCount - The number of values that are stored in the archive
+        param[in] pKeys - The key table of the archive
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        return bool - Returns true if all of the values were read
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::loadType(Board& pBoard, Templates::ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, bool pRaiseCallbacks) { return pBoard.supportType<T>()->load(pReader, pCount, pKeys, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : saveDeltaType<T> - Write the values of a registered type that changed since they were last replicated
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type that has been registered
+
+        param[in] pMap - The Value map of the type
+        param[in] pWriter - The packet that the changes are written to
+        param[in] pVersion - The first version of the Board to include the changes of
+        param[in] pBaseline - The values of the type that were last sent
+
+        return uint32_t - Returns the number of changes that were written
+    */
+    template<typename T>
+    inline uint32_t Utilities::Blackboard::Board::saveDeltaType(Templates::BaseMap* pMap, Templates::ArchiveWriter& pWriter, uint64_t pVersion, Templates::DeltaBaseline& pBaseline) { return ((Utilities::Templates::ValueMap<T>*)(pMap))->saveDelta(pWriter, pVersion, pBaseline); }
+
+    /*
+        Blackboard::Board : loadDeltaType<T> - Apply the replicated changes of a registered type to a Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type that has been registered
+
+        param[in] pBoard - The Board that the changes are applied to
+        param[in] pReader - The packet that the changes are read from
+        param[in] pCount - The number of changes that are stored in the packet
+        param[in] pKeys - The key table of the packet
+        param[in] pBaseline - The values of the type that were last received
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        return bool - Returns true if all of the changes were applied
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::loadDeltaType(Board& pBoard, Templates::ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, Templates::DeltaBaseline& pBaseline, bool pRaiseCallbacks) { return pBoard.supportType<T>()->loadDelta(pReader, pCount, pKeys, pBaseline, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : writeBatch<T> - Apply a list of batched writes to the Value map of their type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pWrites - The keys and values to write, this is cleared once they are applied
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        return size_t - Returns the number of writes that were applied
+    */
+    template<typename T>
+    inline size_t Utilities::Blackboard::Board::writeBatch(std::vector<std::pair<Key, T>>& pWrites, bool pRaiseCallbacks) {
+        //Check there is anything to write
+        const size_t count = pWrites.size();
+        if (!count) return 0;
+
+        //Apply the writes, keeping the capacity of the list for the next commit
+        supportType<T>()->writeBatch(pWrites, pRaiseCallbacks);
+        pWrites.clear();
+        return count;
+    }
+
+    /*
+        Blackboard::Board : batch - Create a Batch that collects writes to the Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised when the writes are committed (Default true)
+
+        return Batch - Returns an empty Batch for the Board
+    */
+    inline Utilities::Blackboard::Batch Utilities::Blackboard::Board::batch(bool pRaiseCallbacks) { return Batch(*this, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : find<T> - Find the values of a list of interned Keys
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKeys - The keys to find the values of
+        param[in] pCount - The number of keys in the list
+        param[out] pOut - The list that a pointer to each value, or nullptr if it doesn't exist, is stored in
+
+        Note: The Value map is resolved once and each stripe is locked once for all of the keys. Keys
+              that fall back to a parent Board are found individually
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::find(const Key* pKeys, size_t pCount, const T** pOut) {
+        //Look for each of the values on this Board and its parents
+        if (mParent) {
+            for (size_t i = 0; i < pCount; i++) pOut[i] = find<T>(pKeys[i]);
+            return;
+        }
+
+        //Find the values in the Value map for the type
+        if (Utilities::Templates::ValueMap<T>* map = findType<T>()) map->find(pKeys, pCount, pOut);
+        else std::fill(pOut, pOut + pCount, nullptr);
+    }
+
+    /*
+        Blackboard::Board : getVersion<T> - Get the version of the Board that a key value last changed in
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to get the version of
+
+        return uint64_t - Returns the version, or 0 if the key has never changed
+
+        Note: A missing key or type will not allocate or modify the Board
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::Board::getVersion(std::string_view pKey) {
+        //Find the interned key without adding it
+        Key key = Templates::KeyTable::get().find(pKey);
+        return (key.isValid() ? getVersion<T>(key) : 0);
+    }
+
+    /*
+        Blackboard::Board : getVersion<T> - Get the version of the Board that a key value last changed in using an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to get the version of
+
+        return uint64_t - Returns the version, or 0 if the key has never changed
+
+        Note: The version of a key that was wiped and has no subscribers is 0
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::Board::getVersion(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Find the Value Map for the type
+        Utilities::Templates::ValueMap<T>* map = findType<T>();
+        return (map ? map->getVersion(pKey) : 0);
+    }
+
+    /*
+        Blackboard::Board : changedSince<T> - Find the keys of a type that have changed since a version of the Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pVersion - The first version to include the changes of, 0 includes every change
+        param[out] pOut - The list that the keys that changed are appended to, each key is listed once
+
+        return uint64_t - Returns the version to pass to the next call, which starts with the changes
+                          made after this one
+
+        Note: Keys that were wiped are included and no longer have a value. A change made during the
+              call may be reported by both this call and the next
+    */
+    template<typename T>
+    inline uint64_t Utilities::Blackboard::Board::changedSince(uint64_t pVersion, std::vector<Key>& pOut) {
+        //Start a new version, so that later changes are found by the next call
+        const uint64_t next = mVersion.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+        //Find the changes
+        if (Utilities::Templates::ValueMap<T>* map = findType<T>()) map->changedSince(pVersion, pOut);
+        return next;
+    }
+
+    /*
+        Blackboard::Board : forEach<T> - Call a function with every value of a type on this Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+
+        param[in] pFunc - The function to call with each of the values
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: The values of parent Boards are not included. The function is called while a stripe of the type is share locked, and the lock can't be
+              re-entered by the visiting thread. It must not call anything that locks values of the type
+              being swept, including reading, finding, writing or wiping them, wiping keys or the Board,
+              publish and save. Values of other types can be read and written
+    */
+    template<typename T, typename TFunc>
+    inline size_t Utilities::Blackboard::Board::forEach(TFunc&& pFunc) {
+        //Check there are values of the type
+        Utilities::Templates::ValueMap<T>* map = findType<T>();
+        if (!map) return 0;
+
+        //Visit each of the stripes in turn
+        size_t count = 0;
+        for (size_t i = 0; i < BLACKBOARD_STRIPE_COUNT; i++) count += map->forEach(i, 0, 1, pFunc);
+        return count;
+    }
+
+    /*
+        Blackboard::Board : forEachParallel<T> - Call a function with every value of a type on this Board,
+                                                 spreading the stripes across a set of threads
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+
+        param[in] pFunc - The function to call with each of the values, from any of the threads at once
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: Threads are created and joined on every call, a job system should be passed to the other
+              overload when sweeps are made often. The function has the same restrictions as for forEach,
+              it must not call anything that locks values of the type being swept
+    */
+    template<typename T, typename TFunc>
+    inline size_t Utilities::Blackboard::Board::forEachParallel(TFunc&& pFunc) { return forEachParallel<T>(std::forward<TFunc>(pFunc), Utilities::Templates::ThreadRunner()); }
+
+    /*
+        Blackboard::Board : forEachParallel<T> - Call a function with every value of a type on this Board,
+                                                 using a job system to run the stripes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+        template TRunner - A function that is callable as void(size_t pCount, Task&& pTask)
+
+        param[in] pFunc - The function to call with each of the values, from any of the threads at once
+        param[in] pRunner - The function that calls the task with each index below the count, returning
+                            once they have all finished. The tasks are independent and may run in any order
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: Each task visits one of BLACKBOARD_PARALLEL_PARTS parts of a stripe while sharing its lock,
+              so the runner is given BLACKBOARD_STRIPE_COUNT * BLACKBOARD_PARALLEL_PARTS tasks. The values
+              of parent Boards are not included. The function has the same restrictions as for forEach, it
+              must not call anything that locks values of the type being swept
+    */
+    template<typename T, typename TFunc, typename TRunner>
+    inline size_t Utilities::Blackboard::Board::forEachParallel(TFunc&& pFunc, TRunner&& pRunner) {
+        //Check there are values of the type
+        Utilities::Templates::ValueMap<T>* map = findType<T>();
+        if (!map) return 0;
+
+        //Visit each part of each stripe as a separate task, neighbouring tasks visit different stripes
+        std::atomic<size_t> count{ 0 };
+        pRunner(size_t(BLACKBOARD_STRIPE_COUNT * BLACKBOARD_PARALLEL_PARTS), [map, &pFunc, &count](size_t pIndex) {
+            count.fetch_add(map->forEach(pIndex % BLACKBOARD_STRIPE_COUNT, pIndex / BLACKBOARD_STRIPE_COUNT, BLACKBOARD_PARALLEL_PARTS, pFunc), std::memory_order_relaxed);
+        });
+        return count.load(std::memory_order_relaxed);
+    }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference as its only parameter
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventKeyCallback<T> pCb) { return subscribe<T>(Key(pKey), pCb); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference as its only parameter
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventKeyCallback<T> pCb) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createKey(pCb)); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventValueCallback<T> pCb) { return subscribe<T>(Key(pKey), pCb); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventValueCallback<T> pCb) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createValue(pCb)); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and a constant reference to
+                        the new value as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventKeyValueCallback<T> pCb) { return subscribe<T>(Key(pKey), pCb); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and a constant reference to
+                        the new value as its only parameters
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventKeyValueCallback<T> pCb) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createPair(pCb)); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventKeyContextCallback<T> pCb, void* pUserData) { return subscribe<T>(Key(pKey), pCb, pUserData); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventKeyContextCallback<T> pCb, void* pUserData) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createKeyContext(pCb, pUserData)); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventValueContextCallback<T> pCb, void* pUserData) { return subscribe<T>(Key(pKey), pCb, pUserData); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
+                        and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventValueContextCallback<T> pCb, void* pUserData) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createValueContext(pCb, pUserData)); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific key value on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference, a constant reference to
+                        the new value and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(std::string_view pKey, EventKeyValueContextCallback<T> pCb, void* pUserData) { return subscribe<T>(Key(pKey), pCb, pUserData); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Add a callback event with user data for a specific interned Key on a type of data
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to assign the callback event to
+        param[in] pCb - A function pointer that takes in a constant string reference, a constant reference to
+                        the new value and the user data pointer
+        param[in] pUserData - A pointer that is passed to the callback event each time it is raised
+
+        return Subscription - Returns a token that can be used to remove the callback event
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const Key& pKey, EventKeyValueContextCallback<T> pCb, void* pUserData) { return addSubscriber<T>(pKey, Templates::ValueMap<T>::Subscriber::createPairContext(pCb, pUserData)); }
+
+    /*
+        Blackboard::Board : unsubscribe - Unsubscribe all events associated with a key value
+                                   for a specific type
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        param[in] pKey - The key to remove the callback events from
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::unsubscribe(std::string_view pKey) {
+        //Find the interned key without adding it
+        Key key = Templates::KeyTable::get().find(pKey);
+
+        //Unsubscribe the key if it exists
+        if (key.isValid()) unsubscribe<T>(key);
+    }
+
+    /*
+        Blackboard::Board : unsubscribe - Unsubscribe all events associated with an interned Key
+                                   for a specific type
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pKey - The key to remove the callback events from
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::unsubscribe(const Key& pKey) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Pass the unsubscribe key to the Value Map if the type has been used
+        if (Utilities::Templates::ValueMap<T>* map = findType<T>()) map->unsubscribe(pKey);
+    }
+
+    /*
+        Blackboard::Board : write<T> - Write a value to a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to save the data value at
+        param[in] pValue - The data value to be saved, converted to the type of the key
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::write(const TypedKey<T>& pKey, const typename TypedKey<T>::Type& pValue, bool pRaiseCallbacks) { write<T>(pKey.resolve(), pValue, pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : read<T> - Read the value of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to read the data value of
+
+        return const T& - Returns a constant reference to the value of the key
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T>
+    inline const T& Utilities::Blackboard::Board::read(const TypedKey<T>& pKey) { return read<T>(pKey.resolve()); }
+
+    /*
+        Blackboard::Board : tryRead<T> - Copy the value of a compile time key if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to read the data value of
+        param[out] pOut - The object that the value is copied into if it exists
+
+        return bool - Returns true if the key had a value
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::tryRead(const TypedKey<T>& pKey, T& pOut) { return tryRead<T>(pKey.resolve(), pOut); }
+
+    /*
+        Blackboard::Board : find<T> - Find the value of a compile time key without creating it
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to find the data value of
+
+        return const T* - Returns a pointer to the value, or nullptr if the key has no value
+
+        Note: When the type is held with Templates::FlatStorage the returned pointer is invalidated
+              by adding a new key to the same stripe
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::Board::find(const TypedKey<T>& pKey) { return find<T>(pKey.resolve()); }
+
+    /*
+        Blackboard::Board : getHandle<T> - Retrieve a Handle to the value slot of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to retrieve the Handle for
+
+        return Handle<T> - Returns a Handle that resolves its slot when it is first used
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Handle<T> Utilities::Blackboard::Board::getHandle(const TypedKey<T>& pKey) { return getHandle<T>(pKey.resolve()); }
+
+    /*
+        Blackboard::Board : modify<T> - Modify the value of a compile time key in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+        template TFunc - A function that takes a T& as its only parameter
+
+        param[in] pKey - The key of the value to modify
+        param[in] pFunc - The function that is given a reference to the value, default constructing it if needed
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
+    */
+    template<typename T, typename TFunc>
+    inline void Utilities::Blackboard::Board::modify(const TypedKey<T>& pKey, TFunc&& pFunc, bool pRaiseCallbacks) { modify<T>(pKey.resolve(), std::forward<TFunc>(pFunc), pRaiseCallbacks); }
+
+    /*
+        Blackboard::Board : wipeTypeKey<T> - Wipe the value stored at a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key of the value to remove
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::wipeTypeKey(const TypedKey<T>& pKey) { wipeTypeKey<T>(pKey.resolve()); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Subscribe a key callback to the changes of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the key that changed
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const TypedKey<T>& pKey, EventKeyCallback<typename TypedKey<T>::Type> pCb) { return subscribe<T>(pKey.resolve(), pCb); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Subscribe a value callback to the changes of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the new value of the key
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const TypedKey<T>& pKey, EventValueCallback<typename TypedKey<T>::Type> pCb) { return subscribe<T>(pKey.resolve(), pCb); }
+
+    /*
+        Blackboard::Board : subscribe<T> - Subscribe a key and value callback to the changes of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to subscribe to
+        param[in] pCb - The function that is given the key that changed and its new value
+
+        return Subscription - Returns a token that can be used to remove the callback
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Subscription Utilities::Blackboard::Board::subscribe(const TypedKey<T>& pKey, EventKeyValueCallback<typename TypedKey<T>::Type> pCb) { return subscribe<T>(pKey.resolve(), pCb); }
+
+    /*
+        Blackboard::Board : unsubscribe<T> - Remove all of the callback events of a compile time key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to remove the callback events of
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Board::unsubscribe(const TypedKey<T>& pKey) { unsubscribe<T>(pKey.resolve()); }
+
+    /*
+        Blackboard::Board : share<T> - Mirror the values of a type on the Board into a shared region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pRegion - The open region to mirror the values into, or nullptr to stop mirroring them
+
+        return bool - Returns true if the values are being mirrored and all existing values were copied
+
+        Note: The region must stay open until the values stop being mirrored or the Board is destroyed.
+              Only the values held by this Board are mirrored, not those of its parents
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Board::share(SharedRegion* pRegion) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be shared between processes");
+
+        //Find the name the type was registered with
+        const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(templateToID<T>());
+        if (!entry || (pRegion && !pRegion->isOpen())) return false;
+
+        //Mirror the values of the Value Map
+        return supportType<T>()->share(pRegion, &entry->mName);
+    }
+
+#ifdef BLACKBOARD_COROUTINES
+    /*
+        Blackboard::Board : changed<T> - Create an awaiter that resumes a coroutine when a key of the Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::Board::changed(std::string_view pKey, ResumeCallback pResume, void* pUserData) { return Changed<T>(*this, Key(pKey), pResume, pUserData); }
+
+    /*
+        Blackboard::Board : changed<T> - Create an awaiter that resumes a coroutine when an interned key of the Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::Board::changed(const Key& pKey, ResumeCallback pResume, void* pUserData) { return Changed<T>(*this, pKey, pResume, pUserData); }
+
+    /*
+        Blackboard::Board : changed<T> - Create an awaiter that resumes a coroutine when a compile time key of the Board next changes
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it on the writing thread (Default nullptr)
+        param[in] pUserData - The pointer that is passed to pResume (Default nullptr)
+
+        return Changed<T> - Returns the awaiter, the result of awaiting it is true if the key was written or false if it was wiped
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T> Utilities::Blackboard::Board::changed(const TypedKey<T>& pKey, ResumeCallback pResume, void* pUserData) { return Changed<T>(*this, pKey.resolve(), pResume, pUserData); }
+#endif
+    #pragma endregion
+
+#ifdef BLACKBOARD_COROUTINES
+    #pragma region Changed
+    /*
+        Blackboard::Changed<T> : Constructor - Initialise the awaiter for a key of a Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pBoard - The Board that the key is waited on
+        param[in] pKey - The key to wait for a change of
+        param[in] pResume - The function that is given the coroutine to resume, or nullptr to resume it directly
+        param[in] pUserData - The pointer that is passed to pResume
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T>::Changed(Board& pBoard, const Key& pKey, ResumeCallback pResume, void* pUserData) : mBoard(&pBoard), mKey(pKey), mMap(nullptr) {
+        mWaiter.mResume = pResume;
+        mWaiter.mUserData = pUserData;
+    }
+
+    /*
+        Blackboard::Changed<T> : Destructor - Remove the coroutine from its key if it is destroyed while waiting
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Changed<T>::~Changed() {
+        if (mMap) mMap->removeWaiter(mKey, mWaiter);
+    }
+
+    /*
+        Blackboard::Changed<T> : await_suspend - Add the suspended coroutine to the waiters of the key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pHandle - The coroutine that is awaiting the change
+    */
+    template<typename T>
+    inline void Utilities::Blackboard::Changed<T>::await_suspend(std::coroutine_handle<> pHandle) {
+        mWaiter.mHandle = pHandle;
+        mMap = mBoard->supportType<T>();
+        mMap->addWaiter(mKey, mWaiter);
+    }
+
+    /*
+        Blackboard::Changed<T> : await_resume - Get the kind of change that resumed the coroutine
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        return bool - Returns true if the key was written, or false if its value was wiped
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Changed<T>::await_resume() const noexcept { return mWaiter.mWritten; }
+    #pragma endregion
+#endif
+
+    #pragma region TypedKey
+    /*
+        Blackboard::TypedKey<T> : resolve - Find the interned Key, adding it to the key table the first time it is used
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - The type of the value stored at the key
+
+        return Key - Returns the interned Key for the text
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Key Utilities::Blackboard::TypedKey<T>::resolve() const { return Templates::KeyTable::get().intern(mText, mHash); }
+    #pragma endregion
+
+    #pragma region Snapshot
+    /*
+        Blackboard::Snapshot : find<T> - Find the published value of an interned Key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the published value or nullptr if it didn't exist at the last publish
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::Snapshot::find(const Key& pKey) const {
+        //Check that there is a frame to read from
+        if (!mFrame || !pKey.isValid()) return nullptr;
+
+        //Find the snapshot buffer for the type
+        const size_t type = templateToID<T>();
+        if (type >= mFrame->mTypes.size() || !mFrame->mTypes[type]) return nullptr;
+
+        //Find the value in the buffer
+        return ((const Utilities::Templates::FlatMap<T>*)mFrame->mTypes[type])->get(pKey.getID());
+    }
+
+    /*
+        Blackboard::Snapshot : find<T> - Find the published value of a key value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the published value or nullptr if it didn't exist at the last publish
+
+        Note: Finding the interned Key for the string share locks the process wide key table, use a Key
+              to read without locking
+    */
+    template<typename T>
+    inline const T* Utilities::Blackboard::Snapshot::find(std::string_view pKey) const { return find<T>(Templates::KeyTable::get().find(pKey)); }
+
+    /*
+        Blackboard::Snapshot : tryRead<T> - Copy the published value of an interned Key if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed at the last publish and was copied into pOut
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::Snapshot::tryRead(const Key& pKey, T& pOut) const {
+        //Find the value
+        const T* value = find<T>(pKey);
+        if (!value) return false;
+
+        //Copy the value out
+        pOut = *value;
+        return true;
+    }
+
+    /*
+        Blackboard::Board : getSnapshot - Retrieve a read only view of the values of the Board at the last publish
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        return Snapshot - Returns the current Snapshot, this is invalid if nothing has been published
+
+        Note: The Snapshot pins its frame until it is released or destroyed, the second publish after it was
+              retrieved waits for that
+    */
+    inline Utilities::Blackboard::Snapshot Utilities::Blackboard::Board::getSnapshot() const {
+        for (;;) {
+            //Find the current frame
+            const Templates::SnapshotFrame* frame = mFront.load(std::memory_order_acquire);
+            if (!frame) return Snapshot();
+
+            //Pin the frame unless a publish has started rebuilding it since it was found
+            if (!(frame->mReaders.fetch_add(1, std::memory_order_acquire) & Templates::SnapshotFrame::WRITING)) return Snapshot(frame);
+            frame->mReaders.fetch_sub(1, std::memory_order_relaxed);
+            std::this_thread::yield();
+        }
+    }
+    #pragma endregion
+
+    #pragma region Batch
+    /*
+        Blackboard::Batch : Move Assignment - Commit the writes of the Batch and take over those of another
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pOther - The Batch to take the writes of
+
+        return Batch& - Returns a reference to this Batch
+    */
+    inline Utilities::Blackboard::Batch& Utilities::Blackboard::Batch::operator=(Batch&& pOther) {
+        //Apply the existing writes before they are replaced
+        if (this != &pOther) {
+            commit();
+            mBoard = pOther.mBoard;
+            mRaiseCallbacks = pOther.mRaiseCallbacks;
+            mTypes = std::move(pOther.mTypes);
+        }
+        return *this;
+    }
+
+    /*
+        Blackboard::Batch : getWrites<T> - Retrieve the list of writes for a type, creating it if it doesn't exist
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        return std::vector<std::pair<Key, T>>& - Returns a reference to the list of writes
+    */
+    template<typename T>
+    inline std::vector<std::pair<Utilities::Blackboard::Key, T>>& Utilities::Blackboard::Batch::getWrites() {
+        //Look for the list in the types that have already been written, a Batch rarely holds more than a few
+        const size_t type = templateToID<T>();
+        for (auto& writes : mTypes)
+            if (writes->mType == type) return ((Templates::ValueBatch<T>*)(writes.get()))->mWrites;
+
+        //Add a new list for the type
+        mTypes.emplace_back(new Templates::ValueBatch<T>(type));
+        return ((Templates::ValueBatch<T>*)(mTypes.back().get()))->mWrites;
+    }
+
+    /*
+        Blackboard::Batch : write<T> - Add the write of a data value to the Batch
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+
+        return Batch& - Returns a reference to this Batch so that writes can be chained
+    */
+    template<typename T>
+    inline Utilities::Blackboard::Batch& Utilities::Blackboard::Batch::write(const Key& pKey, const T& pValue) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Add the write
+        getWrites<T>().emplace_back(pKey, pValue);
+        return *this;
+    }
+
+    /*
+        Blackboard::Batch : write<T> - Add the write of a data value that is moved into the Batch
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location when the Batch is committed
+
+        return Batch& - Returns a reference to this Batch so that writes can be chained
+    */
+    template<typename T, typename>
+    inline Utilities::Blackboard::Batch& Utilities::Blackboard::Batch::write(const Key& pKey, T&& pValue) {
+        //Ensure that the key is valid
+        assert(pKey.isValid());
+
+        //Add the write
+        getWrites<T>().emplace_back(pKey, std::move(pValue));
+        return *this;
+    }
+    #pragma endregion
+
+#ifdef BLACKBOARD_STATS
+    #pragma region SharedRecursiveMutex
+    /*
+        SharedRecursiveMutex : waitFor<TFunc> - Lock the underlying mutex after an attempt to lock it without waiting failed,
+                                                timing the wait
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TFunc - A function that blocks until the underlying mutex is locked
+
+        param[in] pLock - The function that locks the mutex
+    */
+    template<typename TFunc>
+    inline void Utilities::Templates::SharedRecursiveMutex::waitFor(TFunc pLock) {
+        //Time how long the mutex takes to lock
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        pLock();
+
+        //Add the wait to the statistics
+        if (mStats) {
+            mStats->mContended.add();
+            mStats->mWaitNanoseconds.add((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+    #pragma endregion
+#endif
+
+    #pragma region SharedRegion
+    /*
+        Blackboard::SharedRegion : findType<T> - Find the name that a type was registered with
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type
+
+        return const std::string* - Returns a pointer to the registered name, or nullptr if the type hasn't been registered
+    */
+    template<typename T>
+    inline const std::string* Utilities::Blackboard::SharedRegion::findType() {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be shared between processes");
+        const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(templateToID<T>());
+        return (entry ? &entry->mName : nullptr);
+    }
+
+    /*
+        Blackboard::SharedRegion : write<T> - Write a value to a key of the region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to write the value at
+        param[in] pValue - The value to write
+
+        return bool - Returns true if the value was written, or false if the type isn't registered or the region is full
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::write(std::string_view pKey, const T& pValue) {
+        const std::string* type = findType<T>();
+        return (type && write(pKey, *type, &pValue, (uint32_t)sizeof(T)));
+    }
+
+    /*
+        Blackboard::SharedRegion : write<T> - Write a value to an interned key of the region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to write the value at
+        param[in] pValue - The value to write
+
+        return bool - Returns true if the value was written, or false if the type isn't registered or the region is full
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::write(const Key& pKey, const T& pValue) { return write<T>(std::string_view(pKey.getText()), pValue); }
+
+    /*
+        Blackboard::SharedRegion : tryRead<T> - Copy the value of a key out of the region if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to read the value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::tryRead(std::string_view pKey, T& pOut) {
+        //Copy the value into a buffer, so that pOut is untouched if the value doesn't exist
+        const std::string* type = findType<T>();
+        alignas(T) unsigned char buffer[sizeof(T)];
+        if (!type || !read(pKey, *type, buffer, (uint32_t)sizeof(T))) return false;
+        std::memcpy((void*)&pOut, buffer, sizeof(T));
+        return true;
+    }
+
+    /*
+        Blackboard::SharedRegion : tryRead<T> - Copy the value of an interned key out of the region if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to read the value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::tryRead(const Key& pKey, T& pOut) { return tryRead<T>(std::string_view(pKey.getText()), pOut); }
+
+    /*
+        Blackboard::SharedRegion : erase<T> - Mark the value of a key in the region as absent
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to erase the value of
+
+        return bool - Returns true if the key had a value that was erased
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::erase(std::string_view pKey) {
+        const std::string* type = findType<T>();
+        return (type && erase(pKey, *type, (uint32_t)sizeof(T)));
+    }
+
+    /*
+        Blackboard::SharedRegion : erase<T> - Mark the value of an interned key in the region as absent
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type that has been registered with Blackboard::registerType
+
+        param[in] pKey - The key to erase the value of
+
+        return bool - Returns true if the key had a value that was erased
+    */
+    template<typename T>
+    inline bool Utilities::Blackboard::SharedRegion::erase(const Key& pKey) { return erase<T>(std::string_view(pKey.getText())); }
+    #pragma endregion
+
+    #pragma region KeyMap
+    /*
+        findKey - Find a key in a KeyMap without constructing a temporary string where the standard library supports it
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pMap - The map to search
+        param[in] pKey - The key value to find
+
+        return iterator - Returns an iterator to the entry or pMap.end() if it doesn't exist
+    */
+    template<typename TValue>
+    inline typename Utilities::Templates::KeyMap<TValue>::iterator Utilities::Templates::findKey(KeyMap<TValue>& pMap, std::string_view pKey) {
+    #if defined(__cpp_lib_generic_unordered_lookup)
+        //Search with the view directly
+        return pMap.find(pKey);
+    #else
+        //Fall back to constructing a key string
+        return pMap.find(std::string(pKey));
+    #endif
+    }
+    #pragma endregion
+
+    #pragma region SmallVector
+    /*
+        SmallVector<TValue, TInline> : release - Release the heap allocation of the list if it has one
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+    */
+    template<typename TValue, size_t TInline>
+    inline void Utilities::Templates::SmallVector<TValue, TInline>::release() {
+        //Check if the values are on the heap
+        if (mData != inlineData()) std::allocator<TValue>().deallocate(mData, mCapacity);
+
+        //Return to the inline storage
+        mData = inlineData();
+        mCapacity = TInline;
+    }
+
+    /*
+        SmallVector<TValue, TInline> : Copy Assignment - Copy the values of another list
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+
+        param[in] pOther - The list to copy the values of
+
+        return SmallVector& - Returns a reference to this list
+    */
+    template<typename TValue, size_t TInline>
+    inline Utilities::Templates::SmallVector<TValue, TInline>& Utilities::Templates::SmallVector<TValue, TInline>::operator=(const SmallVector& pOther) {
+        //Check for self assignment
+        if (this == &pOther) return *this;
+
+        //Copy the values across
+        assign(pOther.begin(), pOther.end());
+        return *this;
+    }
+
+    /*
+        SmallVector<TValue, TInline> : Move Assignment - Take the values of another list
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+
+        param[in] pOther - The list to take the values of, this is left empty
+
+        return SmallVector& - Returns a reference to this list
+    */
+    template<typename TValue, size_t TInline>
+    inline Utilities::Templates::SmallVector<TValue, TInline>& Utilities::Templates::SmallVector<TValue, TInline>::operator=(SmallVector&& pOther) noexcept {
+        //Check for self assignment
+        if (this == &pOther) return *this;
+
+        //Release the current values
+        release();
+
+        //If the other list is on the heap take its allocation
+        if (pOther.mData != pOther.inlineData()) {
+            mData = pOther.mData;
+            mCapacity = pOther.mCapacity;
+            pOther.mData = pOther.inlineData();
+            pOther.mCapacity = TInline;
+        }
+
+        //Otherwise copy the inline values across
+        else if (pOther.mSize) std::memcpy((void*)mData, pOther.mData, pOther.mSize * sizeof(TValue));
+
+        //Transfer the size
+        mSize = pOther.mSize;
+        pOther.mSize = 0;
+        return *this;
+    }
+
+    /*
+        SmallVector<TValue, TInline> : reserve - Ensure the list can hold a number of values without reallocating
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+
+        param[in] pCapacity - The number of values that the list needs to be able to hold
+    */
+    template<typename TValue, size_t TInline>
+    inline void Utilities::Templates::SmallVector<TValue, TInline>::reserve(size_t pCapacity) {
+        //Check if there is already enough space
+        if (pCapacity <= mCapacity) return;
+
+        //Allocate the new storage and copy the values across
+        TValue* data = std::allocator<TValue>().allocate(pCapacity);
+        if (mSize) std::memcpy((void*)data, mData, mSize * sizeof(TValue));
+
+        //Swap to the new storage
+        const size_t size = mSize;
+        release();
+        mData = data;
+        mCapacity = pCapacity;
+        mSize = size;
+    }
+
+    /*
+        SmallVector<TValue, TInline> : assign - Replace the values of the list with a range of values
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+
+        param[in] pBegin - A pointer to the first value to copy
+        param[in] pEnd - A pointer to one past the last value to copy
+    */
+    template<typename TValue, size_t TInline>
+    inline void Utilities::Templates::SmallVector<TValue, TInline>::assign(const TValue* pBegin, const TValue* pEnd) {
+        //Ensure there is space and copy the values across
+        const size_t count = (size_t)(pEnd - pBegin);
+        mSize = 0;
+        reserve(count);
+        if (count) std::memcpy((void*)mData, pBegin, count * sizeof(TValue));
+        mSize = count;
+    }
+
+    /*
+        SmallVector<TValue, TInline> : erase - Remove a value from the list, keeping the order of the remaining values
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the list
+        template TInline - The number of values that can be stored before a heap allocation is needed
+
+        param[in] pIndex - The index of the value to remove
+    */
+    template<typename TValue, size_t TInline>
+    inline void Utilities::Templates::SmallVector<TValue, TInline>::erase(size_t pIndex) {
+        //Shift the following values down
+        assert(pIndex < mSize);
+        std::memmove((void*)(mData + pIndex), mData + pIndex + 1, (mSize - pIndex - 1) * sizeof(TValue));
+        --mSize;
+    }
+    #pragma endregion
+
+    #pragma region FlatMap
+    /*
+        lowestBit - Find the index of the lowest set bit of a non-zero mask
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        param[in] pMask - The mask to search, must not be 0
+
+        return unsigned int - Returns the index of the lowest set bit
+    */
+    inline unsigned int Utilities::Templates::lowestBit(uint32_t pMask) {
+    #ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, pMask);
+        return (unsigned int)index;
+    #else
+        return (unsigned int)__builtin_ctz(pMask);
+    #endif
+    }
+
+    /*
+        FlatMap<TValue> : Destructor - Destroy all stored values and release the arrays
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+    */
+    template<typename TValue>
+    inline Utilities::Templates::FlatMap<TValue>::~FlatMap() {
+        //Check there is anything to release
+        if (!mCapacity) return;
+
+        //Destroy the stored values
+        for (size_t i = 0; i < mCapacity; i++)
+            if (mCtrl[i] >= 0) mSlots[i].~Slot();
+
+        //Release the arrays
+        releaseArrays(mCtrl, mSlots, mCapacity);
+    }
+
+    /*
+        FlatMap<TValue> : matchByte - Compare a group of control bytes against a value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pGroup - A pointer to the first of GROUP_WIDTH control bytes
+        param[in] pByte - The value to compare the control bytes against
+
+        return uint32_t - Returns a bit mask with a bit set for each control byte that matched
+    */
+    template<typename TValue>
+    inline uint32_t Utilities::Templates::FlatMap<TValue>::matchByte(const int8_t* pGroup, int8_t pByte) {
+    #ifdef BLACKBOARD_FLAT_MAP_SSE2
+        //Compare all of the bytes at once
+        const __m128i ctrl = _mm_loadu_si128((const __m128i*)pGroup);
+        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(pByte)));
+    #else
+        //Compare each of the bytes in turn
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP_WIDTH; i++)
+            mask |= (uint32_t)(pGroup[i] == pByte) << i;
+        return mask;
+    #endif
+    }
+
+    /*
+        FlatMap<TValue> : matchFree - Find the control bytes in a group that are empty or deleted
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pGroup - A pointer to the first of GROUP_WIDTH control bytes
+
+        return uint32_t - Returns a bit mask with a bit set for each control byte that can be filled
+    */
+    template<typename TValue>
+    inline uint32_t Utilities::Templates::FlatMap<TValue>::matchFree(const int8_t* pGroup) {
+    #ifdef BLACKBOARD_FLAT_MAP_SSE2
+        //Free control bytes are the only ones with the sign bit set
+        return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)pGroup));
+    #else
+        //Check the sign of each of the bytes in turn
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP_WIDTH; i++)
+            mask |= (uint32_t)(pGroup[i] < 0) << i;
+        return mask;
+    #endif
+    }
+
+    /*
+        FlatMap<TValue> : findIndex - Find the slot that holds a key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pKey - The key to find
+
+        return size_t - Returns the index of the slot or mCapacity if the key isn't stored
+    */
+    template<typename TValue>
+    inline size_t Utilities::Templates::FlatMap<TValue>::findIndex(uint32_t pKey) const {
+        //Check there are values to search
+        if (!mSize) return mCapacity;
+
+        //Get the starting group of the key
+        const uint64_t keyHash = hash(pKey);
+        const int8_t ctrlHash = controlHash(keyHash);
+        const size_t groupMask = mCapacity / GROUP_WIDTH - 1;
+        size_t group = (size_t)(keyHash >> 32) & groupMask;
+
+        //Probe the groups until a group with an empty slot is reached
+        for (size_t step = 1;; step++) {
+            const int8_t* ctrl = mCtrl + group * GROUP_WIDTH;
+
+            //Check the slots with a matching control hash
+            for (uint32_t match = matchByte(ctrl, ctrlHash); match; match &= match - 1) {
+                const size_t index = group * GROUP_WIDTH + lowestBit(match);
+                if (mSlots[index].first == pKey) return index;
+            }
+
+            //If the group has an empty slot the key would have been placed here
+            if (matchByte(ctrl, CTRL_EMPTY)) return mCapacity;
+
+            //Move to the next group
+            group = (group + step) & groupMask;
+        }
+    }
+
+    /*
+        FlatMap<TValue> : findFree - Find the first slot along the probe sequence of a hash that can be filled
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pHash - The hash of the key that is to be inserted
+
+        return size_t - Returns the index of the free slot
+    */
+    template<typename TValue>
+    inline size_t Utilities::Templates::FlatMap<TValue>::findFree(uint64_t pHash) const {
+        //Get the starting group of the hash
+        const size_t groupMask = mCapacity / GROUP_WIDTH - 1;
+        size_t group = (size_t)(pHash >> 32) & groupMask;
+
+        //Probe the groups until one with a free slot is found
+        for (size_t step = 1;; step++) {
+            if (uint32_t match = matchFree(mCtrl + group * GROUP_WIDTH))
+                return group * GROUP_WIDTH + lowestBit(match);
+            group = (group + step) & groupMask;
+        }
+    }
+
+    /*
+        FlatMap<TValue> : nextOccupied - Find the next slot that holds a value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pIndex - The index to start searching from
+
+        return size_t - Returns the index of the next occupied slot or mCapacity if there are none
+    */
+    template<typename TValue>
+    inline size_t Utilities::Templates::FlatMap<TValue>::nextOccupied(size_t pIndex) const {
+        //Skip over the free slots
+        while (pIndex < mCapacity && mCtrl[pIndex] < 0) ++pIndex;
+        return pIndex;
+    }
+
+    /*
+        FlatMap<TValue> : prepareInsert - Find the slot that a new key will be inserted at, growing the map if needed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pHash - The hash of the key that is to be inserted
+
+        return size_t - Returns the index of the slot that the value should be constructed in
+    */
+    template<typename TValue>
+    inline size_t Utilities::Templates::FlatMap<TValue>::prepareInsert(uint64_t pHash) {
+        //Allocate the first group
+        if (!mCapacity) rehash(GROUP_WIDTH);
+
+        //Find the slot to fill
+        size_t index = findFree(pHash);
+
+        //If an empty slot would be used past the maximum load, grow or clear the deleted slots
+        if (!mGrowthLeft && mCtrl[index] == CTRL_EMPTY) {
+            rehash(mSize * 2 >= maxLoad(mCapacity) ? mCapacity * 2 : mCapacity);
+            index = findFree(pHash);
+        }
+
+        //Return the slot
+        return index;
+    }
+
+    /*
+        FlatMap<TValue> : commitInsert - Mark a slot as holding a newly constructed value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pIndex - The index of the slot that was filled
+        param[in] pHash - The hash of the key that was inserted
+    */
+    template<typename TValue>
+    inline void Utilities::Templates::FlatMap<TValue>::commitInsert(size_t pIndex, uint64_t pHash) {
+        //Deleted slots are reused without reducing the growth allowance
+        if (mCtrl[pIndex] == CTRL_EMPTY) --mGrowthLeft;
+
+        //Flag the slot as occupied
+        mCtrl[pIndex] = controlHash(pHash);
+        ++mSize;
+    }
+
+    /*
+        FlatMap<TValue> : rehash - Move all values into a new set of arrays
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pCapacity - The number of slots in the new arrays, must be a power of two multiple of GROUP_WIDTH
+    */
+    template<typename TValue>
+    inline void Utilities::Templates::FlatMap<TValue>::rehash(size_t pCapacity) {
+        //Keep the previous arrays
+        int8_t* oldCtrl = mCtrl;
+        Slot* oldSlots = mSlots;
+        const size_t oldCapacity = mCapacity;
+
+        //Allocate the new arrays
+        mCtrl = (int8_t*)mResource->allocate(pCapacity, alignof(int8_t));
+        std::memset(mCtrl, CTRL_EMPTY, pCapacity);
+        mSlots = (Slot*)mResource->allocate(pCapacity * sizeof(Slot), alignof(Slot));
+        mCapacity = pCapacity;
+        mGrowthLeft = maxLoad(pCapacity) - mSize;
+
+        //Check there is anything to move
+        if (!oldCapacity) return;
+
+        //Move the values across
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (oldCtrl[i] < 0) continue;
+            const uint64_t keyHash = hash(oldSlots[i].first);
+            const size_t index = findFree(keyHash);
+            mCtrl[index] = controlHash(keyHash);
+            new (&mSlots[index]) Slot(std::move(oldSlots[i]));
+            oldSlots[i].~Slot();
+        }
+
+        //Release the previous arrays
+        releaseArrays(oldCtrl, oldSlots, oldCapacity);
+
+        //Flag that previous references are no longer valid
+        if (mSize) ++mRelocations;
+    }
+
+    /*
+        FlatMap<TValue> : releaseArrays - Return a set of control byte and slot arrays to the memory resource
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pCtrl - The control byte array to release
+        param[in] pSlots - The slot array to release, the values must already be destroyed
+        param[in] pCapacity - The number of slots in the arrays
+    */
+    template<typename TValue>
+    inline void Utilities::Templates::FlatMap<TValue>::releaseArrays(int8_t* pCtrl, Slot* pSlots, size_t pCapacity) {
+        mResource->deallocate(pCtrl, pCapacity, alignof(int8_t));
+        mResource->deallocate(pSlots, pCapacity * sizeof(Slot), alignof(Slot));
+    }
+
+    /*
+        FlatMap<TValue> : insert_or_assign - Assign a value to a key, inserting it if it doesn't exist
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+        template TArg - The type of the value that is being assigned
+
+        param[in] pKey - The key to assign the value to
+        param[in] pValue - The value to assign
+
+        return std::pair<iterator, bool> - Returns an iterator to the entry and a flag that is true if it was inserted
+    */
+    template<typename TValue>
+    template<typename TArg>
+    inline std::pair<typename Utilities::Templates::FlatMap<TValue>::iterator, bool> Utilities::Templates::FlatMap<TValue>::insert_or_assign(uint32_t pKey, TArg&& pValue) {
+        //Assign the value if the key already exists
+        size_t index = findIndex(pKey);
+        if (index != mCapacity) {
+            mSlots[index].second = std::forward<TArg>(pValue);
+            return { iterator(this, index), false };
+        }
+
+        //Construct the new value
+        const uint64_t keyHash = hash(pKey);
+        index = prepareInsert(keyHash);
+        new (&mSlots[index]) Slot(pKey, std::forward<TArg>(pValue));
+        commitInsert(index, keyHash);
+        return { iterator(this, index), true };
+    }
+
+    /*
+        FlatMap<TValue> : try_emplace - Construct a value in place for a key if it doesn't exist
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+        template TArgs - The types of the arguments passed to the constructor of TValue
+
+        param[in] pKey - The key to construct the value for
+        param[in] pArgs - The arguments that will be forwarded to the constructor, these are untouched if the key exists
+
+        return std::pair<iterator, bool> - Returns an iterator to the entry and a flag that is true if it was inserted
+    */
+    template<typename TValue>
+    template<typename... TArgs>
+    inline std::pair<typename Utilities::Templates::FlatMap<TValue>::iterator, bool> Utilities::Templates::FlatMap<TValue>::try_emplace(uint32_t pKey, TArgs&&... pArgs) {
+        //Check if the key already exists
+        size_t index = findIndex(pKey);
+        if (index != mCapacity) return { iterator(this, index), false };
+
+        //Construct the new value
+        const uint64_t keyHash = hash(pKey);
+        index = prepareInsert(keyHash);
+        new (&mSlots[index]) Slot(std::piecewise_construct, std::forward_as_tuple(pKey), std::forward_as_tuple(std::forward<TArgs>(pArgs)...));
+        commitInsert(index, keyHash);
+        return { iterator(this, index), true };
+    }
+
+    /*
+        FlatMap<TValue> : erase - Remove the value stored for a key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+
+        param[in] pKey - The key to remove
+
+        return size_t - Returns the number of values that were removed
+    */
+    template<typename TValue>
+    inline size_t Utilities::Templates::FlatMap<TValue>::erase(uint32_t pKey) {
+        //Find the slot for the key
+        const size_t index = findIndex(pKey);
+        if (index == mCapacity) return 0;
+
+        //Destroy the value
+        mSlots[index].~Slot();
+        --mSize;
+
+        //If the group has an empty slot no probe can have passed through it, so the slot can be emptied
+        if (matchByte(mCtrl + (index & ~(GROUP_WIDTH - 1)), CTRL_EMPTY)) {
+            mCtrl[index] = CTRL_EMPTY;
+            ++mGrowthLeft;
+        }
+
+        //Otherwise leave a marker so that probes continue past it
+        else mCtrl[index] = CTRL_DELETED;
+        return 1;
+    }
+
+    /*
+        FlatMap<TValue> : clear - Remove all values from the map, keeping the allocated arrays
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template TValue - The type of value stored in the map
+    */
+    template<typename TValue>
+    inline void Utilities::Templates::FlatMap<TValue>::clear() {
+        //Check there is anything to clear
+        if (!mCapacity) return;
+
+        //Destroy the stored values
+        for (size_t i = 0; i < mCapacity; i++)
+            if (mCtrl[i] >= 0) mSlots[i].~Slot();
+
+        //Reset the control bytes
+        std::memset(mCtrl, CTRL_EMPTY, mCapacity);
+        mSize = 0;
+        mGrowthLeft = maxLoad(mCapacity);
+    }
+    #pragma endregion
+
+    #pragma region ValueMap
+    /*
+        ValueMap<T> : write - Write a data value to the key location
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::write(const Key& pKey, const T& pValue, bool pRaiseCallbacks) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Copy the data value across
+        Record& record = stripe.mRecords[pKey.getID()];
+        storeValue(record, pValue);
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pKey);
+    }
+
+    /*
+        ValueMap<T> : write - Write a data value to the key location that expires after a lifetime
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pLifetime - The number of milliseconds of the timer wheel until the value expires
+        param[in] pTimers - The timer wheel of the Board that the expiry is scheduled on
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::write(const Key& pKey, const T& pValue, uint64_t pLifetime, TimerWheel& pTimers, bool pRaiseCallbacks) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Copy the data value across
+        Record& record = stripe.mRecords[pKey.getID()];
+        storeValue(record, pValue);
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pKey.getID());
+
+        //Schedule the expiry while the stripe is locked, so the timer can't be handled before the record knows of it
+        record.mExpiry = pTimers.schedule(this, pKey.getID(), pLifetime);
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pKey);
+    }
+
+    /*
+        ValueMap<T> : write - Move a data value into the key location
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::write(const Key& pKey, T&& pValue, bool pRaiseCallbacks) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Move the data value across
+        Record& record = stripe.mRecords[pKey.getID()];
+        storeValue(record, std::move(pValue));
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pKey);
+    }
+
+    /*
+        ValueMap<T> : emplace - Construct a data value in place at the key location
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pKey - The key value to construct the data value at
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+    */
+    template<typename T, typename TStorage>
+    template<typename... TArgs>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::emplace(const Key& pKey, TArgs&&... pArgs) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Construct the value in place, or replace the value if the key already has one
+        Record& record = stripe.mRecords[pKey.getID()];
+        if (record.mValue) *record.mValue = T(std::forward<TArgs>(pArgs)...);
+        else constructValue(record, std::forward<TArgs>(pArgs)...);
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pKey.getID());
+
+        //Raise the callback events
+        raiseEvents(guard, record, pKey);
+    }
+
+    /*
+        ValueMap<T> : modify - Modify the value at the key location in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pKey - The key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    template<typename TFunc>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::modify(const Key& pKey, TFunc& pFunc, bool pRaiseCallbacks) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Modify the value in place
+        Record& record = stripe.mRecords[pKey.getID()];
+        pFunc(ensureValue(record));
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pKey);
+    }
+
+    /*
+        ValueMap<T> : read - Read the value of a key location
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to read the data value of
+
+        return const T& - Returns a constant reference to the value, creating a default value if the key doesn't exist
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T, typename TStorage>
+    inline const T& Utilities::Templates::ValueMap<T, TStorage>::read(const Key& pKey) {
+        //Get the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+
+        //Attempt to find an existing value while sharing the lock with other readers
+        {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+            auto found = stripe.mRecords.find(pKey.getID());
+            if (found != stripe.mRecords.end() && found->second.mValue) {
+                countRead(found->second);
+                return *found->second.mValue;
+            }
+        }
+
+        //Lock the stripe exclusively to create the missing value
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Create the value if another thread hasn't already
+        Record& record = stripe.mRecords[pKey.getID()];
+        if (!record.mValue) {
+            ensureValue(record);
+            trackChange(stripe, record, pKey.getID());
+        }
+        countRead(record);
+
+        //Return the value at the key location
+        return *record.mValue;
+    }
+
+    /*
+        ValueMap<T> : tryRead - Copy the value of a key location if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to read the data value of
+        param[out] pOut - The object that the value will be copied into if it exists
+
+        return bool - Returns true if the value existed and was copied into pOut
+    */
+    template<typename T, typename TStorage>
+    inline bool Utilities::Templates::ValueMap<T, TStorage>::tryRead(const Key& pKey, T& pOut) {
+        //Share the stripe for the key with other readers
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the value
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found == stripe.mRecords.end() || !found->second.mValue) return false;
+
+        //Copy the value out
+        countRead(found->second);
+        pOut = *found->second.mValue;
+        return true;
+    }
+
+    /*
+        ValueMap<T> : find - Find the value of a key location if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+    */
+    template<typename T, typename TStorage>
+    inline const T* Utilities::Templates::ValueMap<T, TStorage>::find(const Key& pKey) {
+        //Share the stripe for the key with other readers
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the value
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found == stripe.mRecords.end() || !found->second.mValue) return nullptr;
+        countRead(found->second);
+        return &*found->second.mValue;
+    }
+
+    /*
+        ValueMap<T> : find - Find the values of a list of key locations
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKeys - The keys to find the values of
+        param[in] pCount - The number of keys in the list
+        param[out] pOut - The list that a pointer to each value, or nullptr if it doesn't exist, is stored in
+
+        Note: When the type is held with Templates::FlatStorage the returned pointers are invalidated
+              by adding a new key to the same stripe
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::find(const Key* pKeys, size_t pCount, const T** pOut) {
+        //Find the keys of each of the stripes in turn, locking the stripes that are used once
+        for (size_t index = 0; index < BLACKBOARD_STRIPE_COUNT; index++) {
+            Stripe& stripe = mStripes[index];
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock, std::defer_lock);
+            for (size_t i = 0; i < pCount; i++) {
+                if (stripeIndex(pKeys[i]) != index) continue;
+                if (!guard.owns_lock()) guard.lock();
+
+                //Find the value
+                auto found = stripe.mRecords.find(pKeys[i].getID());
+                if (found == stripe.mRecords.end() || !found->second.mValue) {
+                    pOut[i] = nullptr;
+                    continue;
+                }
+                countRead(found->second);
+                pOut[i] = &*found->second.mValue;
+            }
+        }
+    }
+
+    /*
+        ValueMap<T> : forEach - Call a function with each of the values stored in a part of a stripe
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TFunc - A function that is callable as void(const Key&, const T&) or void(const T&)
+
+        param[in] pStripe - The index of the stripe to visit
+        param[in] pPart - The index of the part of the stripe to visit
+        param[in] pPartCount - The number of equal parts that the containers of the stripe are split into
+        param[in] pFunc - The function to call with each of the values
+
+        return size_t - Returns the number of values that the function was called with
+
+        Note: The stripe is shared for the whole call, so the function must not lock it again. Functions that only take the value are called
+              straight from the stripe's records, without looking up the keys
+    */
+    template<typename T, typename TStorage>
+    template<typename TFunc>
+    inline size_t Utilities::Templates::ValueMap<T, TStorage>::forEach(size_t pStripe, size_t pPart, size_t pPartCount, TFunc& pFunc) {
+        Stripe& stripe = mStripes[pStripe];
+        std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+        size_t count = 0;
+        if constexpr (std::is_invocable<TFunc&, const Key&, const T&>::value) {
+            //Find the keys of the values with a single use of the key table
+            std::vector<uint32_t> ids;
+            std::vector<const T*> values;
+            ids.reserve(stripe.mRecords.size() / pPartCount + 1);
+            values.reserve(stripe.mRecords.size() / pPartCount + 1);
+            TStorage::visit(stripe.mRecords, pPart, pPartCount, [&ids, &values](auto& pEntry) {
+                if (!pEntry.second.mValue) return;
+                ids.push_back(pEntry.first);
+                values.push_back(&*pEntry.second.mValue);
+            });
+            std::vector<Key> keys(ids.size());
+            KeyTable::get().find(ids.data(), ids.size(), keys.data());
+
+            //Visit the values
+            for (size_t i = 0; i < keys.size(); i++) pFunc(static_cast<const Key&>(keys[i]), *values[i]);
+            count = keys.size();
+        } else {
+            //Visit the values
+            TStorage::visit(stripe.mRecords, pPart, pPartCount, [&pFunc, &count](auto& pEntry) {
+                if (!pEntry.second.mValue) return;
+                pFunc(static_cast<const T&>(*pEntry.second.mValue));
+                ++count;
+            });
+        }
+        BLACKBOARD_STAT(mStats.mReads.add(count);)
+        return count;
+    }
+
+    /*
+        ValueMap<T> : writeBatch - Move a list of data values into their key locations
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pWrites - The keys and values to write, the values are moved out of the list
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        Note: Each stripe is locked once for all of its writes. Keys with listeners are flagged as
+              pending the first time they are written, and their events are raised with their current
+              value once every stripe has been written
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::writeBatch(std::vector<std::pair<Key, T>>& pWrites, bool pRaiseCallbacks) {
+        //Apply the writes of each of the stripes in turn, locking the stripes that are used once
+        std::vector<Key> notify;
+    #ifdef BLACKBOARD_COROUTINES
+        WakeList woken;
+    #endif
+        for (size_t index = 0; index < BLACKBOARD_STRIPE_COUNT; index++) {
+            Stripe& stripe = mStripes[index];
+            std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock, std::defer_lock);
+            for (auto& write : pWrites) {
+                const Key& key = write.first;
+                if (stripeIndex(key) != index) continue;
+                if (!guard.owns_lock()) guard.lock();
+
+                //Move the data value across
+                Record& record = stripe.mRecords[key.getID()];
+                storeValue(record, std::move(write.second));
+                countWrite(record);
+
+                //List the key for the next snapshot
+                trackChange(stripe, record, key.getID());
+
+            #ifdef BLACKBOARD_COROUTINES
+                //Take the coroutines waiting for the key, they are resumed once all of the writes are done
+                if (pRaiseCallbacks) woken.add(takeWaiters(stripe, key.getID(), true));
+            #endif
+
+                //Flag keys with listeners so their events are only raised once
+                if (!pRaiseCallbacks || !record.mSubscribers || record.mPending) continue;
+                record.mPending = true;
+
+                //If events are deferred queue a notification, otherwise raise the events once the writes are done
+                if (mQueue->isDeferring()) mQueue->push(new EventQueue::Node{ nullptr, this, key });
+                else notify.push_back(key);
+            }
+        }
+
+        //Raise the events of the keys with the values they now hold
+        for (const Key& key : notify) raisePending(key);
+    }
+
+    /*
+        ValueMap<T> : write - Write a data value to the key location of a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be saved to the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::write(Handle& pHandle, const T& pValue, bool pRaiseCallbacks) {
+        //Lock the stripe for the Handle
+        Stripe& stripe = mStripes[pHandle.mStripe];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Copy the data value across
+        Record& record = resolveSlot(stripe, pHandle);
+        *record.mValue = pValue;
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pHandle.mKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pHandle.mKey);
+    }
+
+    /*
+        ValueMap<T> : write - Move a data value into the key location of a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pHandle - The Handle to the key value to save the data value at
+        param[in] pValue - The data value to be moved into the key location
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::write(Handle& pHandle, T&& pValue, bool pRaiseCallbacks) {
+        //Lock the stripe for the Handle
+        Stripe& stripe = mStripes[pHandle.mStripe];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Move the data value across
+        Record& record = resolveSlot(stripe, pHandle);
+        *record.mValue = std::move(pValue);
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pHandle.mKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pHandle.mKey);
+    }
+
+    /*
+        ValueMap<T> : modify - Modify the value at the key location of a pre-resolved Handle in place
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TFunc - A callable type that takes a T& as its only parameter
+
+        param[in] pHandle - The Handle to the key value of the data value to modify
+        param[in] pFunc - The function that will be given a reference to the stored value
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+    */
+    template<typename T, typename TStorage>
+    template<typename TFunc>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::modify(Handle& pHandle, TFunc& pFunc, bool pRaiseCallbacks) {
+        //Lock the stripe for the Handle
+        Stripe& stripe = mStripes[pHandle.mStripe];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Modify the value in place
+        Record& record = resolveSlot(stripe, pHandle);
+        pFunc(*record.mValue);
+        countWrite(record);
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pHandle.mKey.getID());
+
+        //Check event flag
+        if (pRaiseCallbacks) raiseEvents(guard, record, pHandle.mKey);
+    }
+
+    /*
+        ValueMap<T> : read - Read the value of the key location of a pre-resolved Handle
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pHandle - The Handle to the key value to read the data value of
+
+        return const T& - Returns a constant reference to the value, creating a default value if the key doesn't exist
+
+        Note: The stripe lock is released before the reference is returned, so it must not be used
+              while another thread writes, modifies or wipes the key. Use tryRead<T> to copy the
+              value under the lock when the key is shared between threads. When the type is held
+              with Templates::FlatStorage the reference is also invalidated by adding a new key to
+              the same stripe
+    */
+    template<typename T, typename TStorage>
+    inline const T& Utilities::Templates::ValueMap<T, TStorage>::read(Handle& pHandle) {
+        //Get the stripe for the Handle
+        Stripe& stripe = mStripes[pHandle.mStripe];
+
+        //If the Handle is still resolved, read while sharing the lock with other readers
+        {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+            if (pHandle.mSlot && pHandle.mGeneration == getGeneration(stripe)) {
+                countRead(*pHandle.mSlot);
+                return *pHandle.mSlot->mValue;
+            }
+        }
+
+        //Lock the stripe exclusively to re-resolve the Handle
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Return the value at the key location
+        Record& record = resolveSlot(stripe, pHandle);
+        countRead(record);
+        return *record.mValue;
+    }
+
+    /*
+        ValueMap<T> : find - Find the value of the key location of a Handle if it exists
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pHandle - The Handle to the key value to find the data value of
+
+        return const T* - Returns a pointer to the stored value or nullptr if it doesn't exist
+    */
+    template<typename T, typename TStorage>
+    inline const T* Utilities::Templates::ValueMap<T, TStorage>::find(Handle& pHandle) {
+        //Share the stripe for the Handle with other readers
+        Stripe& stripe = mStripes[pHandle.mStripe];
+        std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //If the Handle is still resolved return its value
+        if (pHandle.mSlot && pHandle.mGeneration == getGeneration(stripe)) {
+            countRead(*pHandle.mSlot);
+            return &*pHandle.mSlot->mValue;
+        }
+
+        //Find the record without creating it
+        auto found = stripe.mRecords.find(pHandle.mKey.getID());
+        if (found == stripe.mRecords.end() || !found->second.mValue) return nullptr;
+
+        //Point the Handle at the record
+        pHandle.mSlot = &found->second;
+        pHandle.mGeneration = getGeneration(stripe);
+        countRead(found->second);
+        return &*found->second.mValue;
+    }
+
+    /*
+        ValueMap<T> : resolveSlot - Ensure that a Handle is pointing at the current record for its key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pStripe - The stripe that the Handle's key belongs to
+        param[in] pHandle - The Handle to resolve
+
+        return Record& - Returns a reference to the record that the Handle points to, which will always hold a value
+
+        Note: This function must be called with the stripe exclusively locked
+    */
+    template<typename T, typename TStorage>
+    inline typename Utilities::Templates::ValueMap<T, TStorage>::Record& Utilities::Templates::ValueMap<T, TStorage>::resolveSlot(Stripe& pStripe, Handle& pHandle) {
+        //Check if the record needs to be re-resolved
+        if (!pHandle.mSlot || pHandle.mGeneration != getGeneration(pStripe)) {
+            Record& record = pStripe.mRecords[pHandle.mKey.getID()];
+            if (!record.mValue) {
+                ensureValue(record);
+                trackChange(pStripe, record, pHandle.mKey.getID());
+            }
+            pHandle.mSlot = &record;
+            pHandle.mGeneration = getGeneration(pStripe);
+        }
+
+        //Return the record
+        return *pHandle.mSlot;
+    }
+
+    /*
+        ValueMap<T> : storeValue - Assign a value to a record, constructing it if the record doesn't have one
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TArg - The type of the value that is being assigned
+
+        param[in] pRecord - The record to store the value in
+        param[in] pValue - The value to copy or move into the record
+
+        return T& - Returns a reference to the stored value
+    */
+    template<typename T, typename TStorage>
+    template<typename TArg>
+    inline T& Utilities::Templates::ValueMap<T, TStorage>::storeValue(Record& pRecord, TArg&& pValue) {
+        //Assign over an existing value to reuse its resources
+        if (pRecord.mValue) return (*pRecord.mValue = std::forward<TArg>(pValue));
+
+        //Construct the value
+        return constructValue(pRecord, std::forward<TArg>(pValue));
+    }
+
+    /*
+        ValueMap<T> : constructValue - Construct the value of a record that doesn't have one
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+        template TArgs - The types of the arguments passed to the constructor of T
+
+        param[in] pRecord - The record to construct the value in
+        param[in] pArgs - The arguments that will be forwarded to the constructor of T
+
+        return T& - Returns a reference to the constructed value
+    */
+    template<typename T, typename TStorage>
+    template<typename... TArgs>
+    inline T& Utilities::Templates::ValueMap<T, TStorage>::constructValue(Record& pRecord, TArgs&&... pArgs) {
+        //Flag that the key has gained a value, as it may now hide the value of a parent Board
+        mLayout->fetch_add(1, std::memory_order_release);
+
+        //Construct the value
+        return pRecord.mValue.emplace(std::forward<TArgs>(pArgs)...);
+    }
+
+    /*
+        ValueMap<T> : raiseEvents - Unlock a stripe and raise the callback events that are associated with a key value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pGuard - The lock that is held over the stripe, this will be unlocked before the events are raised
+        param[in] pRecord - The record of the key value that was modified, this must hold a value
+        param[in] pKey - The key value that was modified
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::raiseEvents(std::unique_lock<SharedRecursiveMutex>& pGuard, Record& pRecord, const Key& pKey) {
+    #ifdef BLACKBOARD_COROUTINES
+        //Take the coroutines waiting for the key, they are resumed once the stripe has been released
+        WakeList woken;
+        woken.add(takeWaiters(mStripes[stripeIndex(pKey)], pKey.getID(), true));
+    #endif
+
+        //Skip keys that have no listeners
+        if (!pRecord.mSubscribers) {
+            pGuard.unlock();
+            return;
+        }
+
+        //If events are deferred queue a notification, unless the key already has one waiting
+        if (mQueue->isDeferring()) {
+            if (!pRecord.mPending) {
+                pRecord.mPending = true;
+                mQueue->push(new EventQueue::Node{ nullptr, this, pKey });
+            }
+            pGuard.unlock();
+            return;
+        }
+
+        //Raise the events
+        dispatchEvents(pGuard, *pRecord.mSubscribers, pKey, *pRecord.mValue);
+    }
+
+    /*
+        ValueMap<T> : dispatchEvents - Unlock a stripe and raise the callback events of a list of subscribers
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pGuard - The lock that is held over the stripe, this will be unlocked before the events are raised
+        param[in] pSubscribers - The subscribers of the key
+        param[in] pKey - The key value that was modified
+        param[in] pValue - The new value that was assigned to the key
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::dispatchEvents(std::unique_lock<SharedRecursiveMutex>& pGuard, const SubscriberList& pSubscribers, const Key& pKey, const T& pValue) {
+        //Copy the subscribers so that callbacks can modify the subscriptions of the key, keeping the copy off the heap for most keys
+        SmallVector<Subscriber, 8> subscribers;
+        subscribers.assign(pSubscribers.begin(), pSubscribers.end());
+
+        //Check if any of the subscribers need the value
+        bool needsValue = false;
+        for (const Subscriber& subscriber : subscribers)
+            needsValue |= subscriber.needsValue();
+
+        //If only the key is needed release the stripe and raise the events
+        if (!needsValue) {
+            pGuard.unlock();
+            BLACKBOARD_STAT(CallbackTimer timer(mStats, subscribers.size());)
+            for (const Subscriber& subscriber : subscribers)
+                subscriber.raise(pKey.getText(), nullptr);
+            return;
+        }
+
+        //Copy the value so the stripe can be released before the events are raised
+        if constexpr (std::is_copy_constructible<T>::value) {
+            const T value(pValue);
+            pGuard.unlock();
+
+            //Raise the events
+            BLACKBOARD_STAT(CallbackTimer timer(mStats, subscribers.size());)
+            for (const Subscriber& subscriber : subscribers)
+                subscriber.raise(pKey.getText(), &value);
+        }
+
+        //Move-only values can't be copied, so are raised with the stripe still locked
+        else {
+            BLACKBOARD_STAT(CallbackTimer timer(mStats, subscribers.size());)
+            for (const Subscriber& subscriber : subscribers)
+                subscriber.raise(pKey.getText(), &pValue);
+            pGuard.unlock();
+        }
+    }
+
+    /*
+        ValueMap<T>::Subscriber : raise - Raise the callback event of a subscriber
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value that was modified
+        param[in] pValue - A pointer to the new value that was assigned to the key, only used if the callback needs it
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::Subscriber::raise(const std::string& pKey, const T* pValue) const {
+        //Pass the values to the callback that is stored
+        switch (mType) {
+        case EType::Key: mKeyCb(pKey); break;
+        case EType::Value: mValueCb(*pValue); break;
+        case EType::Pair: mPairCb(pKey, *pValue); break;
+        case EType::KeyContext: mKeyContextCb(pKey, mUserData); break;
+        case EType::ValueContext: mValueContextCb(*pValue, mUserData); break;
+        case EType::PairContext: mPairContextCb(pKey, *pValue, mUserData); break;
+        }
+    }
+
+    /*
+        ValueMap<T> : raisePending - Raise the callback events of a deferred notification with the current value of the key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value that the notification was queued for
+
+        Note: Notifications for keys that have since been wiped or unsubscribed are discarded
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::raisePending(const Key& pKey) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the record of the key, discarding notifications that have already been raised
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found == stripe.mRecords.end() || !found->second.mPending) return;
+        Record& record = found->second;
+
+        //Allow following writes to queue a new notification
+        record.mPending = false;
+
+        //Check that the key still has a value and subscribers
+        if (!record.mValue || !record.mSubscribers) return;
+
+        //Raise the events
+        dispatchEvents(guard, *record.mSubscribers, pKey, *record.mValue);
+    }
+
+    /*
+        ValueMap<T> : addSubscriber - Add a callback event subscriber to a key value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key to add the subscriber to
+        param[in] pSubscriber - The subscriber to add
+
+        return uint32_t - Returns the ID that was assigned to the subscriber
+    */
+    template<typename T, typename TStorage>
+    inline uint32_t Utilities::Templates::ValueMap<T, TStorage>::addSubscriber(const Key& pKey, Subscriber pSubscriber) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Assign the subscriber an ID, skipping the invalid ID if the counter wraps
+        pSubscriber.mID = stripe.mNextSubscriber++;
+        if (!stripe.mNextSubscriber) stripe.mNextSubscriber = 1;
+
+        //Create the subscriber list if this is the key's first listener
+        Record& record = stripe.mRecords[pKey.getID()];
+        indexKey(record, pKey.getID());
+        if (!record.mSubscribers) {
+            record.mSubscribers = std::make_unique<SubscriberList>();
+            ++stripe.mListened;
+        }
+
+        //Add the subscriber to the end of the key's list
+        record.mSubscribers->push_back(pSubscriber);
+        return pSubscriber.mID;
+    }
+
+    /*
+        ValueMap<T> : releaseSubscribers - Remove all of the subscribers from a key record
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pStripe - The stripe that the record belongs to
+        param[in] pID - The atom ID of the key that the record belongs to
+        param[in] pRecord - The record to remove the subscribers from
+
+        Note: This function must be called with the stripe exclusively locked. The record
+              is erased if it doesn't hold a value, so must not be used after this call
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::releaseSubscribers(Stripe& pStripe, uint32_t pID, Record& pRecord) {
+        //Check that the record has subscribers
+        if (!pRecord.mSubscribers) return;
+
+        //Remove the subscribers
+        pRecord.mSubscribers.reset();
+        --pStripe.mListened;
+
+        //Erase the record once it no longer holds anything
+        if (!pRecord.mValue) {
+            pStripe.mRecords.erase(pID);
+            mIndex->remove(pID, mType);
+            ++pStripe.mGeneration;
+        }
+    }
+
+    /*
+        ValueMap<T> : removeSubscriber - Remove a single callback event subscriber from a key value
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key to remove the subscriber from
+        param[in] pID - The ID of the subscriber to remove
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::removeSubscriber(const Key& pKey, uint32_t pID) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the subscribers of the key
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found == stripe.mRecords.end() || !found->second.mSubscribers) return;
+
+        //Remove the subscriber with the ID
+        SubscriberList& subscribers = *found->second.mSubscribers;
+        for (size_t i = 0; i < subscribers.size(); i++) {
+            if (subscribers[i].mID == pID) {
+                subscribers.erase(i);
+                break;
+            }
+        }
+
+        //Remove the list once it is empty
+        if (subscribers.empty()) releaseSubscribers(stripe, pKey.getID(), found->second);
+    }
+
+    /*
+        ValueMap<T> : wipeKey - Clear the value associated with a key value
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key value to clear the entry of
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::wipeKey(const Key& pKey) {
+    #ifdef BLACKBOARD_COROUTINES
+        //Store the coroutines waiting for the key, they are resumed once the stripe has been released
+        WakeList woken;
+    #endif
+
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the value, removing the key from the type index if it was erased by a previous wipe
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found == stripe.mRecords.end()) {
+            mIndex->remove(pKey.getID(), mType);
+            return;
+        }
+        if (!found->second.mValue) return;
+
+        //List the key for the next snapshot
+        trackChange(stripe, found->second, pKey.getID());
+    #ifdef BLACKBOARD_COROUTINES
+        woken.add(takeWaiters(stripe, pKey.getID(), false));
+    #endif
+
+        //Erase the value, keeping the record if the key still has subscribers
+        if (found->second.mSubscribers) found->second.mValue.reset();
+        else {
+            stripe.mRecords.erase(pKey.getID());
+            mIndex->remove(pKey.getID(), mType);
+        }
+        eraseMirror(pKey.getID());
+        ++stripe.mGeneration;
+    }
+
+    /*
+        ValueMap<T> : expire - Erase a value once the lifetime it was written with has ended
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pID - The atom ID of the key of the value
+        param[in] pDeadline - The deadline of the timer that expired
+        param[in] pRaiseCallbacks - A flag to indicate if the subscribers of the key are raised with the expired value
+
+        return bool - Returns true if the value was erased, or false if it has been changed since the timer was added
+
+        Note: The callback events are raised straight away, even while the Board is deferring events, as the
+              value no longer exists when the deferred notifications are raised
+    */
+    template<typename T, typename TStorage>
+    inline bool Utilities::Templates::ValueMap<T, TStorage>::expire(uint32_t pID, uint64_t pDeadline, bool pRaiseCallbacks) {
+    #ifdef BLACKBOARD_COROUTINES
+        //Store the coroutines waiting for the key, they are resumed once the stripe has been released
+        WakeList woken;
+    #endif
+
+        //Lock the stripe for the key
+        const Key key = KeyTable::get().find(pID);
+        Stripe& stripe = mStripes[stripeIndex(key)];
+        std::unique_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Check the value is the one that the timer was added for
+        auto found = stripe.mRecords.find(pID);
+        if (found == stripe.mRecords.end() || !found->second.mValue || found->second.mExpiry != pDeadline) return false;
+        Record& record = found->second;
+
+        //List the key for the next snapshot
+        trackChange(stripe, record, pID);
+    #ifdef BLACKBOARD_COROUTINES
+        woken.add(takeWaiters(stripe, pID, false));
+    #endif
+        eraseMirror(pID);
+        ++stripe.mGeneration;
+
+        //Drop the record if the key has no subscribers
+        if (!record.mSubscribers) {
+            stripe.mRecords.erase(pID);
+            mIndex->remove(pID, mType);
+            return true;
+        }
+
+        //Erase the value, raising the subscribers with the value that expired
+        std::optional<T> expired(std::move(record.mValue));
+        record.mValue.reset();
+        if (pRaiseCallbacks) dispatchEvents(guard, *record.mSubscribers, key, *expired);
+        return true;
+    }
+
+    /*
+        ValueMap<T> : wipeAll - Erase all data stored in the map
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pWipeCallbacks - Flags if the subscribers of the keys are removed as well as the values
+
+        Note: The containers of the stripes keep their capacity, so refilling the map doesn't allocate them again
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::wipeAll(bool pWipeCallbacks) {
+        //Rebuild the snapshots from the remaining values
+        invalidateSnapshots();
+
+        //Clear each of the stripes in turn
+        for (Stripe& stripe : mStripes) {
+        #ifdef BLACKBOARD_COROUTINES
+            //Store the coroutines waiting for keys of the stripe, they are resumed once the stripe has been released
+            WakeList woken;
+        #endif
+            std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+            ++stripe.mGeneration;
+
+            //Log the removal of each of the values
+            for (auto& entry : stripe.mRecords) {
+                if (!entry.second.mValue) continue;
+                trackChange(stripe, entry.second, entry.first);
+                eraseMirror(entry.first);
+            #ifdef BLACKBOARD_COROUTINES
+                woken.add(takeWaiters(stripe, entry.first, false));
+            #endif
+            }
+
+            //If none of the keys keep their listeners all of the records can be dropped
+            if (pWipeCallbacks || !stripe.mListened) {
+                stripe.mRecords.clear();
+                stripe.mListened = 0;
+                continue;
+            }
+
+            //Erase the values, keeping the records of keys that still have subscribers
+            std::vector<uint32_t> unused;
+            for (auto& entry : stripe.mRecords) {
+                if (entry.second.mSubscribers) entry.second.mValue.reset();
+                else unused.push_back(entry.first);
+            }
+            for (uint32_t id : unused) stripe.mRecords.erase(id);
+        }
+    }
+
+    /*
+        ValueMap<T> : unsubscribe - Remove all callback events associated with a key value
+        Author: Mitchell Croft
+        Created: 08/11/2016
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key to wipe all callback events associated with
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::unsubscribe(const Key& pKey) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Remove the callbacks, removing the key from the type index if it was erased by a previous wipe
+        auto found = stripe.mRecords.find(pKey.getID());
+        if (found != stripe.mRecords.end()) releaseSubscribers(stripe, pKey.getID(), found->second);
+        else mIndex->remove(pKey.getID(), mType);
+    }
+
+    /*
+        ValueMap<T> : trackChange - Stamp a key with the current version and list it as changed for the next snapshot publish
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pStripe - The stripe that the key belongs to
+        param[in] pRecord - The record of the key that changed
+        param[in] pID - The atom ID of the key that changed
+
+        Note: This function must be called with the stripe exclusively locked and after the value of
+              the record has changed. Keys are only logged once per version and listed once per frame,
+              and are only listed while the owning Board is in snapshot mode
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::trackChange(Stripe& pStripe, Record& pRecord, uint32_t pID) {
+        //Changing the value clears its lifetime, writes with a lifetime set it again afterwards
+        pRecord.mExpiry = 0;
+
+        //Ensure the Board knows that this type holds the key
+        indexKey(pRecord, pID);
+
+        //Update the copy of the value in the shared region
+        mirrorValue(pRecord, pID);
+
+        //Log the change the first time the key changes in the current version
+        const uint64_t version = mVersion->load(std::memory_order_relaxed);
+        if (pRecord.mVersion != version) {
+            pRecord.mVersion = version;
+            pStripe.mLog.push_back({ version, pID });
+            if (pStripe.mLog.size() >= pStripe.mCompactAt) compactLog(pStripe);
+        }
+
+        //Skip the listing if snapshots aren't in use or the key is already listed
+        if (!mSnapshotting->load(std::memory_order_relaxed) || pRecord.mChangedFrame == pStripe.mFrame) return;
+
+        //List the key
+        pRecord.mChangedFrame = pStripe.mFrame;
+        pStripe.mChanged.push_back(pID);
+    }
+
+    /*
+        ValueMap<T> : mirrorValue - Copy the value of a record into the shared region, or remove it once the value
+                                    is erased
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pRecord - The record of the key that changed
+        param[in] pID - The atom ID of the key that changed
+
+        Note: This function must be called with the stripe exclusively locked
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::mirrorValue(const Record& pRecord, uint32_t pID) {
+        //Update the shared region if the values are being shared
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (Blackboard::SharedRegion* region = mShared.load(std::memory_order_acquire)) {
+                const std::string& key = KeyTable::get().find(pID).getText();
+                if (pRecord.mValue) region->write(key, *mSharedType, &*pRecord.mValue, (uint32_t)sizeof(T));
+                else region->erase(key, *mSharedType, (uint32_t)sizeof(T));
+            }
+        }
+    }
+
+    /*
+        ValueMap<T> : eraseMirror - Remove the value of a key from the shared region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pID - The atom ID of the key that was erased
+
+        Note: This function must be called with the stripe exclusively locked
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::eraseMirror(uint32_t pID) {
+        //Remove the value from the shared region if the values are being shared
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (Blackboard::SharedRegion* region = mShared.load(std::memory_order_acquire))
+                region->erase(KeyTable::get().find(pID).getText(), *mSharedType, (uint32_t)sizeof(T));
+        }
+        (void)pID;
+    }
+
+    /*
+        ValueMap<T> : share - Mirror the values into a shared region
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A trivially copyable type
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pRegion - The region to mirror the values into, or nullptr to stop mirroring them
+        param[in] pType - The name that the type was registered with
+
+        return bool - Returns true if every existing value was copied into the region
+    */
+    template<typename T, typename TStorage>
+    inline bool Utilities::Templates::ValueMap<T, TStorage>::share(Blackboard::SharedRegion* pRegion, const std::string* pType) {
+        //Point the map at the region, writes after this point mirror themselves
+        mSharedType = pType;
+        mShared.store(pRegion, std::memory_order_release);
+        if (!pRegion) return true;
+
+        //Copy the existing values of each stripe across
+        bool copied = true;
+        for (Stripe& stripe : mStripes) {
+            std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+            for (auto& entry : stripe.mRecords)
+                if (entry.second.mValue) copied &= pRegion->write(KeyTable::get().find(entry.first).getText(), *pType, &*entry.second.mValue, (uint32_t)sizeof(T));
+        }
+        return copied;
+    }
+
+    /*
+        ValueMap<T> : compactLog - Remove the changes from the log of a stripe that have been superseded
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pStripe - The stripe to compact the log of
+
+        Note: This function must be called with the stripe exclusively locked. Only the latest change
+              of each key is kept, including those of keys that have since been erased, so that
+              removals are still reported
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::compactLog(Stripe& pStripe) {
+        //Find the position of the latest change of each key
+        std::unordered_map<uint32_t, size_t> latest;
+        latest.reserve(pStripe.mLog.size());
+        for (size_t i = 0; i < pStripe.mLog.size(); i++) latest[pStripe.mLog[i].mID] = i;
+
+        //Keep the latest changes in their original order
+        size_t kept = 0;
+        for (size_t i = 0; i < pStripe.mLog.size(); i++)
+            if (latest[pStripe.mLog[i].mID] == i) pStripe.mLog[kept++] = pStripe.mLog[i];
+        pStripe.mLog.resize(kept);
+
+        //Allow the log to double before it is compacted again
+        pStripe.mCompactAt = std::max<size_t>(64, kept * 2);
+    }
+
+    /*
+        ValueMap<T> : changedSince - Find the keys that have changed since a version of the Board
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pVersion - The first version to include the changes of
+        param[out] pOut - The list that the keys that changed are appended to, each key is listed once
+
+        Note: Keys that were wiped are included, they no longer have a value
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::changedSince(uint64_t pVersion, std::vector<Key>& pOut) {
+        //Collect the changes of each of the stripes
+        std::vector<uint32_t> changed;
+        for (Stripe& stripe : mStripes) {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+            //The log is in version order, so the changes are at the end of it
+            auto first = std::lower_bound(stripe.mLog.begin(), stripe.mLog.end(), pVersion, [](const Change& pChange, uint64_t pValue) { return pChange.mVersion < pValue; });
+            for (; first != stripe.mLog.end(); ++first) changed.push_back(first->mID);
+        }
+
+        //Remove the keys that changed in more than one version
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+        //Add the keys
+        pOut.reserve(pOut.size() + changed.size());
+        for (uint32_t id : changed) pOut.push_back(KeyTable::get().find(id));
+    }
+
+    /*
+        ValueMap<T> : getVersion - Get the version of the Board that a key last changed in
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key to get the version of
+
+        return uint64_t - Returns the version, or 0 if the key has no record
+    */
+    template<typename T, typename TStorage>
+    inline uint64_t Utilities::Templates::ValueMap<T, TStorage>::getVersion(const Key& pKey) {
+        //Share the stripe for the key with other readers
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Find the record
+        auto found = stripe.mRecords.find(pKey.getID());
+        return (found != stripe.mRecords.end() ? found->second.mVersion : 0);
+    }
+
+    /*
+        ValueMap<T> : publish - Bring one of the snapshot buffers up to date with the current values
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pBuffer - The index of the snapshot buffer to update
+
+        return const void* - Returns a pointer to the FlatMap<T> buffer or nullptr if the type can't be copied
+
+        Note: The buffer was last updated two publishes ago, so the keys that changed in both of the
+              frames since then are copied across. The Board has already waited for the Snapshots
+              that pinned the buffer to be released
+    */
+    template<typename T, typename TStorage>
+    inline const void* Utilities::Templates::ValueMap<T, TStorage>::publish(size_t pBuffer) {
+        //Values that can't be copied don't have snapshots
+        if constexpr (!std::is_copy_constructible<T>::value) return nullptr;
+        else {
+            FlatMap<T>& target = mSnapshots[pBuffer];
+
+            //Check if the buffer needs to be rebuilt from every value
+            const uint8_t rebuild = mRebuild.load(std::memory_order_acquire);
+            if (rebuild) target.clear();
+
+            //Update each of the stripes in turn
+            for (Stripe& stripe : mStripes) {
+                std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+                //Copy all of the values across
+                if (rebuild) {
+                    for (auto& entry : stripe.mRecords)
+                        if (entry.second.mValue) target.insert_or_assign(entry.first, *entry.second.mValue);
+                }
+
+                //Copy the changed values across, removing the keys that no longer have one
+                else {
+                    for (const std::pmr::vector<uint32_t>* changed : { &stripe.mPreviousChanged, &stripe.mChanged }) {
+                        for (uint32_t id : *changed) {
+                            auto found = stripe.mRecords.find(id);
+                            if (found != stripe.mRecords.end() && found->second.mValue) target.insert_or_assign(id, *found->second.mValue);
+                            else target.erase(id);
+                        }
+                    }
+                }
+
+                //Start a new frame for the stripe
+                stripe.mPreviousChanged.swap(stripe.mChanged);
+                stripe.mChanged.clear();
+                ++stripe.mFrame;
+            }
+
+            //Count the rebuild, unless the values were wiped again in the mean time
+            uint8_t expected = rebuild;
+            if (rebuild) mRebuild.compare_exchange_strong(expected, (uint8_t)(rebuild - 1), std::memory_order_acq_rel);
+            return &target;
+        }
+    }
+
+    /*
+        ValueMap<T> : save - Write all of the values in the map to an archive
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pWriter - The archive that the values are written to
+
+        return uint32_t - Returns the number of values that were written
+
+        Note: Block values are written as an array of key indices followed by an aligned array of values,
+              other types are written as a key index followed by the encoded value. Each stripe is
+              copied while it is locked, so writes made during the save may only be partially included
+    */
+    template<typename T, typename TStorage>
+    inline uint32_t Utilities::Templates::ValueMap<T, TStorage>::save(ArchiveWriter& pWriter) {
+        uint32_t count = 0;
+        if constexpr (Codec<T>::IsBlock) {
+            //Collect the keys and values of each of the stripes
+            std::vector<uint32_t> keys;
+            std::vector<T> values;
+            for (Stripe& stripe : mStripes) {
+                std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+                for (auto& entry : stripe.mRecords) {
+                    if (!entry.second.mValue) continue;
+                    keys.push_back(pWriter.indexKey(entry.first));
+                    values.push_back(*entry.second.mValue);
+                }
+            }
+
+            //Write the keys, followed by the values
+            count = (uint32_t)keys.size();
+            pWriter.write(keys.data(), keys.size() * sizeof(uint32_t));
+            pWriter.align(alignof(T));
+            pWriter.write(values.data(), values.size() * sizeof(T));
+        } else {
+            //Encode the values of each of the stripes
+            for (Stripe& stripe : mStripes) {
+                std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+                for (auto& entry : stripe.mRecords) {
+                    if (!entry.second.mValue) continue;
+                    pWriter.write(pWriter.indexKey(entry.first));
+                    Codec<T>::encode(pWriter, *entry.second.mValue);
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+    /*
+        ValueMap<T> : load - Read values from an archive and write them to the map
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pReader - The archive that the values are read from
+        param[in] pCount - The number of values that are stored in the archive
+        param[in] pKeys - The key table of the archive
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        return bool - Returns true if all of the values were read, or false if the archive is malformed
+
+        Note: Key indices and block values are read from the archive in batches, so a corrupt count fails
+              once the archive runs out. When reading from memory the values are not copied into an
+              intermediate buffer first
+    */
+    template<typename T, typename TStorage>
+    inline bool Utilities::Templates::ValueMap<T, TStorage>::load(ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, bool pRaiseCallbacks) {
+        if constexpr (Codec<T>::IsBlock) {
+            //Read the key indices in batches, so that the list only grows as far as the archive holds them
+            const size_t batch = 1024;
+            std::vector<uint32_t> keys;
+            for (size_t start = 0; start < pCount; start += batch) {
+                const size_t size = std::min<size_t>(batch, pCount - start);
+                keys.resize(start + size);
+                if (!pReader.read(keys.data() + start, size * sizeof(uint32_t))) return false;
+            }
+            if (!pReader.align(alignof(T))) return false;
+
+            //Write the values in batches, so that streamed archives don't need to be buffered in full
+            T value;
+            for (size_t start = 0; start < pCount; start += batch) {
+                const size_t size = std::min<size_t>(batch, pCount - start);
+                const char* data = (const char*)pReader.view(size * sizeof(T));
+                if (!data) return false;
+                for (size_t i = 0; i < size; i++) {
+                    const uint32_t index = keys[start + i];
+                    if (index >= pKeys.size()) return false;
+                    std::memcpy((void*)&value, data + i * sizeof(T), sizeof(T));
+                    write(pKeys[index], value, pRaiseCallbacks);
+                }
+            }
+        } else {
+            //Decode each of the values in turn
+            for (uint32_t i = 0; i < pCount; i++) {
+                uint32_t index;
+                T value{};
+                if (!pReader.read(index) || index >= pKeys.size() || !Codec<T>::decode(pReader, value)) return false;
+                write(pKeys[index], std::move(value), pRaiseCallbacks);
+            }
+        }
+        return true;
+    }
+
+#ifdef BLACKBOARD_COROUTINES
+    /*
+        ValueMap<T> : addWaiter - Add a suspended coroutine to the waiters of a key
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key to wait for a change of
+        param[in] pWaiter - The waiter of the coroutine, this must remain valid until it is resumed or removed
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::addWaiter(const Key& pKey, KeyWaiter& pWaiter) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Add the waiter to the front of the list, the list is reversed when it is taken
+        KeyWaiter*& head = stripe.mWaiters[pKey.getID()];
+        pWaiter.mNext = head;
+        pWaiter.mWaiting = true;
+        head = &pWaiter;
+    }
+
+    /*
+        ValueMap<T> : removeWaiter - Remove a coroutine from the waiters of a key if it hasn't been resumed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pKey - The key that the coroutine is waiting for
+        param[in] pWaiter - The waiter of the coroutine
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::removeWaiter(const Key& pKey, KeyWaiter& pWaiter) {
+        //Lock the stripe for the key
+        Stripe& stripe = mStripes[stripeIndex(pKey)];
+        std::lock_guard<SharedRecursiveMutex> guard(stripe.mLock);
+
+        //Check the waiter is still listed
+        if (!pWaiter.mWaiting) return;
+        auto found = stripe.mWaiters.find(pKey.getID());
+        if (found == stripe.mWaiters.end()) return;
+
+        //Unlink the waiter, removing the list once it is empty
+        for (KeyWaiter** link = &found->second; *link; link = &(*link)->mNext) {
+            if (*link != &pWaiter) continue;
+            *link = pWaiter.mNext;
+            break;
+        }
+        pWaiter.mWaiting = false;
+        if (!found->second) stripe.mWaiters.erase(found);
+    }
+
+    /*
+        ValueMap<T> : takeWaiters - Remove all of the waiters of a key so that they can be resumed
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pStripe - The stripe that the key belongs to
+        param[in] pID - The atom ID of the key
+        param[in] pWritten - A flag to indicate if the key was written rather than wiped
+
+        return KeyWaiter* - Returns the waiters in the order they started waiting, or nullptr if there are none
+
+        Note: This function must be called with the stripe exclusively locked, the waiters must be resumed
+              after it has been released
+    */
+    template<typename T, typename TStorage>
+    inline Utilities::Templates::KeyWaiter* Utilities::Templates::ValueMap<T, TStorage>::takeWaiters(Stripe& pStripe, uint32_t pID, bool pWritten) {
+        //Find the list of the key
+        if (pStripe.mWaiters.empty()) return nullptr;
+        auto found = pStripe.mWaiters.find(pID);
+        if (found == pStripe.mWaiters.end()) return nullptr;
+        KeyWaiter* list = found->second;
+        pStripe.mWaiters.erase(found);
+
+        //Reverse the list so that waiters are resumed in the order they were added, flagging them as woken
+        KeyWaiter* ordered = nullptr;
+        while (list) {
+            KeyWaiter* next = list->mNext;
+            list->mWaiting = false;
+            list->mWritten = pWritten;
+            list->mNext = ordered;
+            ordered = list;
+            list = next;
+        }
+        return ordered;
+    }
+#endif
+
+    /*
+        ValueMap<T> : saveDelta - Write the values that have changed since they were last replicated
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pWriter - The packet that the changes are written to
+        param[in] pVersion - The first version of the Board to include the changes of
+        param[in] pBaseline - The values that were last sent, updated with the values that are written
+
+        return uint32_t - Returns the number of changes that were written
+
+        Note: Each change is a key index and an EDelta operation. Values that match the baseline are
+              skipped, block values that only differ in a few bytes are written as a mask of the bytes
+              that changed followed by those bytes. Keys are only sent as removed if they were sent
+    */
+    template<typename T, typename TStorage>
+    inline uint32_t Utilities::Templates::ValueMap<T, TStorage>::saveDelta(ArchiveWriter& pWriter, uint64_t pVersion, DeltaBaseline& pBaseline) {
+        uint32_t count = 0;
+        std::vector<char> encoded;
+        ArchiveWriter scratch;
+        for (Stripe& stripe : mStripes) {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+
+            //The log is in version order, so the changes are at the end of it
+            auto first = std::lower_bound(stripe.mLog.begin(), stripe.mLog.end(), pVersion, [](const Change& pChange, uint64_t pValue) { return pChange.mVersion < pValue; });
+            for (; first != stripe.mLog.end(); ++first) {
+                const uint32_t id = first->mID;
+                auto found = stripe.mRecords.find(id);
+                auto previous = pBaseline.find(id);
+
+                //Send the removal of keys that no longer have a value
+                if (found == stripe.mRecords.end() || !found->second.mValue) {
+                    if (previous == pBaseline.end()) continue;
+                    pBaseline.erase(previous);
+                    pWriter.write(pWriter.indexKey(id));
+                    pWriter.write(EDelta::Erase);
+                    ++count;
+                    continue;
+                }
+
+                //Encode the value, skipping it if it hasn't changed since it was last sent
+                if constexpr (Codec<T>::IsBlock) {
+                    encoded.resize(sizeof(T));
+                    std::memcpy(encoded.data(), (const void*)&*found->second.mValue, sizeof(T));
+                } else {
+                    scratch.truncate(0);
+                    Codec<T>::encode(scratch, *found->second.mValue);
+                    encoded.assign(scratch.getBuffer().begin(), scratch.getBuffer().end());
+                }
+                if (previous != pBaseline.end() && previous->second == encoded) continue;
+                pWriter.write(pWriter.indexKey(id));
+                ++count;
+
+                //Write only the bytes that changed if that is smaller than the value
+                if constexpr (Codec<T>::IsBlock) {
+                    if (previous != pBaseline.end()) {
+                        uint8_t mask[(sizeof(T) + 7) / 8] = {};
+                        size_t changed = 0;
+                        for (size_t i = 0; i < sizeof(T); i++) {
+                            if (encoded[i] == previous->second[i]) continue;
+                            mask[i / 8] |= (uint8_t)(1u << (i % 8));
+                            ++changed;
+                        }
+                        if (sizeof(mask) + changed < sizeof(T)) {
+                            pWriter.write(EDelta::Patch);
+                            pWriter.write(mask, sizeof(mask));
+                            for (size_t i = 0; i < sizeof(T); i++)
+                                if (mask[i / 8] & (1u << (i % 8))) pWriter.write(encoded[i]);
+                            previous->second.swap(encoded);
+                            continue;
+                        }
+                    }
+                }
+
+                //Write the whole value
+                pWriter.write(EDelta::Value);
+                pWriter.write(encoded.data(), encoded.size());
+                if (previous != pBaseline.end()) previous->second.swap(encoded);
+                else pBaseline.emplace(id, encoded);
+            }
+        }
+        return count;
+    }
+
+    /*
+        ValueMap<T> : loadDelta - Apply the replicated changes read from a packet to the map
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[in] pReader - The packet that the changes are read from
+        param[in] pCount - The number of changes that are stored in the packet
+        param[in] pKeys - The key table of the packet
+        param[in] pBaseline - The values that were last received, updated with the values that are read
+        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised
+
+        return bool - Returns true if all of the changes were applied, or false if the packet is malformed
+                      or patches a value that wasn't received
+    */
+    template<typename T, typename TStorage>
+    inline bool Utilities::Templates::ValueMap<T, TStorage>::loadDelta(ArchiveReader& pReader, uint32_t pCount, const std::vector<Key>& pKeys, DeltaBaseline& pBaseline, bool pRaiseCallbacks) {
+        for (uint32_t i = 0; i < pCount; i++) {
+            //Read the key and the operation that is applied to it
+            uint32_t index;
+            EDelta operation;
+            if (!pReader.read(index) || index >= pKeys.size() || !pReader.read(operation)) return false;
+            const Key& key = pKeys[index];
+
+            //Remove the value of the key
+            if (operation == EDelta::Erase) {
+                pBaseline.erase(key.getID());
+                wipeKey(key);
+                continue;
+            }
+
+            if constexpr (Codec<T>::IsBlock) {
+                std::vector<char>& bytes = pBaseline[key.getID()];
+
+                //Read the whole value
+                if (operation == EDelta::Value) {
+                    bytes.resize(sizeof(T));
+                    if (!pReader.read(bytes.data(), sizeof(T))) return false;
+                }
+
+                //Update the bytes of the previous value that changed
+                else if (operation == EDelta::Patch && bytes.size() == sizeof(T)) {
+                    uint8_t mask[(sizeof(T) + 7) / 8];
+                    if (!pReader.read(mask, sizeof(mask))) return false;
+                    for (size_t b = 0; b < sizeof(T); b++)
+                        if ((mask[b / 8] & (1u << (b % 8))) && !pReader.read(bytes[b])) return false;
+                }
+                else return false;
+
+                //Write the value
+                T value;
+                std::memcpy((void*)&value, bytes.data(), sizeof(T));
+                write(key, value, pRaiseCallbacks);
+            } else {
+                //Decode the value
+                T value{};
+                if (operation != EDelta::Value || !Codec<T>::decode(pReader, value)) return false;
+                write(key, std::move(value), pRaiseCallbacks);
+            }
+        }
+        return true;
+    }
+
+    /*
+        ValueMap<T> : release - Destroy the map and return its memory to the resource it was allocated from
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        Note: The map must not be used after this call
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::release() {
+        //Keep the resource, as it is stored in the map
+        std::pmr::memory_resource* resource = mResource;
+
+        //Destroy the map and release its memory
+        this->~ValueMap();
+        resource->deallocate(this, sizeof(ValueMap), alignof(ValueMap));
+    }
+
+#ifdef BLACKBOARD_STATS
+    /*
+        ValueMap<T> : collectStats - Add the statistics of each key that has been accessed to a list
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+
+        param[out] pOut - The list that the statistics of the keys are appended to
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::collectStats(std::vector<Blackboard::Stats::KeyAccess>& pOut) {
+        //Collect the keys of each of the stripes in turn
+        for (Stripe& stripe : mStripes) {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+            for (auto& entry : stripe.mRecords) {
+                const KeyStats& stats = entry.second.mStats;
+                if (stats.mReads.load() || stats.mWrites.load())
+                    pOut.push_back({ KeyTable::get().find(entry.first), mType, stats.mReads.load(), stats.mWrites.load() });
+            }
+        }
+    }
+
+    /*
+        ValueMap<T> : resetStats - Reset the statistics of each key to 0
+        Author: Mitchell Croft
+        Created: 14/10/2026
+        Modified: 14/10/2026
+
+        template T - A generic, non void type 
+        template TStorage - The storage policy that defines the containers used by the stripes
+    */
+    template<typename T, typename TStorage>
+    inline void Utilities::Templates::ValueMap<T, TStorage>::resetStats() {
+        //Reset the counters of the type
+        mStats.reset();
+
+        //Reset the keys of each of the stripes in turn
+        for (Stripe& stripe : mStripes) {
+            std::shared_lock<SharedRecursiveMutex> guard(stripe.mLock);
+            for (auto& entry : stripe.mRecords) {
+                entry.second.mStats.mReads.reset();
+                entry.second.mStats.mWrites.reset();
+            }
+        }
+    }
+#endif
+    #pragma endregion
+    #pragma endregion
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////                                                                                                                      ////
+/////                                                      Object Definition                                               ////
+/////                                                                                                                      ////
+/////  Include a define for _BLACKBOARD_ in a single .cpp file inside of the project to use the Blackboard functionality   ////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef _BLACKBOARD_
+//! Include the platform functions used to map shared memory
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//! Define the Blackboards static singleton instance
+Utilities::Blackboard::Board* Utilities::Blackboard::mInstance = nullptr;
+
+//! Define the memory pool of the singleton instance
+std::pmr::memory_resource* Utilities::Blackboard::mPool = nullptr;
+
+//! Define the Blackboards Board epoch counter
+std::atomic<size_t> Utilities::Blackboard::mEpochCounter(0);
+
+//! Define the Blackboards type index counter
+std::atomic<size_t> Utilities::Blackboard::mTypeCounter(0);
+
+/*
+    SharedRecursiveMutex : lock - Acquire exclusive ownership of the mutex, blocking until it is available
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::SharedRecursiveMutex::lock() {
+    //Check if this thread already owns the mutex
+    const std::thread::id self = std::this_thread::get_id();
+    if (mOwner.load(std::memory_order_acquire) == self) {
+        ++mDepth;
+        return;
+    }
+
+    //Lock the underlying mutex, timing the wait if it is contended
+#ifdef BLACKBOARD_STATS
+    if (!mLock.try_lock()) waitFor([this]() { mLock.lock(); });
+#else
+    mLock.lock();
+#endif
+
+    //Flag this thread as the owner
+    mOwner.store(self, std::memory_order_release);
+    mDepth = 1;
+}
+
+/*
+    SharedRecursiveMutex : unlock - Release one level of exclusive ownership of the mutex
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::SharedRecursiveMutex::unlock() {
+    //Check if this is the outer most lock
+    if (--mDepth == 0) {
+        //Clear the owner 
+        mOwner.store(std::thread::id(), std::memory_order_release);
+
+        //Unlock the underlying mutex
+        mLock.unlock();
+    }
+}
+
+/*
+    SharedRecursiveMutex : lock_shared - Acquire shared ownership of the mutex, blocking until it is available
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::SharedRecursiveMutex::lock_shared() {
+    //If this thread has exclusive ownership treat it as a nested lock
+    if (mOwner.load(std::memory_order_acquire) == std::this_thread::get_id()) ++mDepth;
+
+    //Otherwise share the underlying mutex, timing the wait if it is contended
+#ifdef BLACKBOARD_STATS
+    else if (!mLock.try_lock_shared()) waitFor([this]() { mLock.lock_shared(); });
+#else
+    else mLock.lock_shared();
+#endif
+}
+
+/*
+    SharedRecursiveMutex : unlock_shared - Release shared ownership of the mutex
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::SharedRecursiveMutex::unlock_shared() {
+    //If this thread has exclusive ownership treat it as a nested lock
+    if (mOwner.load(std::memory_order_acquire) == std::this_thread::get_id()) --mDepth;
+
+    //Otherwise release the shared underlying mutex
+    else mLock.unlock_shared();
+}
+
+/*
+    KeyTable : get - Retrieve the process wide table of interned keys
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return KeyTable& - Returns a reference to the table
+*/
+Utilities::Templates::KeyTable& Utilities::Templates::KeyTable::get() {
+    //Create the table the first time it is used
+    static KeyTable table;
+
+    //Return the table
+    return table;
+}
+
+/*
+    KeyTable : intern - Retrieve the Key for a string, adding it to the table if it doesn't exist
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key string to intern
+
+    return Key - Returns the interned Key for the string
+*/
+Utilities::Blackboard::Key Utilities::Templates::KeyTable::intern(std::string_view pKey) {
+    //Look for an existing entry while sharing the table with other threads
+    Blackboard::Key existing = find(pKey);
+    if (existing.isValid()) return existing;
+
+    //Lock the table exclusively to add the new entry
+    std::lock_guard<SharedRecursiveMutex> guard(mLock);
+
+    //Add the entry, another thread may have added it in the mean time
+    auto found = findKey(mAtoms, pKey);
+    if (found == mAtoms.end()) {
+        found = mAtoms.emplace(std::string(pKey), (uint32_t)mAtoms.size()).first;
+        mTexts.push_back(&found->first);
+    }
+
+    //Return the Key
+    return Blackboard::Key(found->second, &found->first);
+}
+
+/*
+    KeyTable : intern - Retrieve the Key for a string with a precomputed hash, caching it so it can be found without locking
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key string to intern
+    param[in] pHash - The hashKey hash of the string
+
+    return Blackboard::Key - Returns the Key for the string
+
+    Note: The cache is searched from the position of the hash, each slot is claimed by its hash and filled
+          once the key has been interned. Keys that collide with full slots, or that are searched for while
+          their slot is being filled, are interned through the locked table instead
+*/
+Utilities::Blackboard::Key Utilities::Templates::KeyTable::intern(std::string_view pKey, uint64_t pHash) {
+    //Reserve 0 for empty slots
+    const uint64_t hash = (pHash ? pHash : 1);
+    const size_t mask = BLACKBOARD_TYPED_KEY_CACHE - 1;
+
+    //Search a limited number of slots from the position of the hash
+    for (size_t i = 0; i < 16; i++) {
+        CacheSlot& slot = mCache[(size_t)(hash + i) & mask];
+        uint64_t current = slot.mHash.load(std::memory_order_acquire);
+
+        //Claim an empty slot for the key
+        if (!current) {
+            Blackboard::Key key = intern(pKey);
+            if (slot.mHash.compare_exchange_strong(current, hash, std::memory_order_acq_rel)) {
+                slot.mID.store(key.mID, std::memory_order_relaxed);
+                slot.mText.store(key.mText, std::memory_order_release);
+            }
+            return key;
+        }
+
+        //Check if the slot holds the key
+        if (current != hash) continue;
+        const std::string* text = slot.mText.load(std::memory_order_acquire);
+        if (!text) break;
+        if (*text == pKey) return Blackboard::Key(slot.mID.load(std::memory_order_relaxed), text);
+    }
+    return intern(pKey);
+}
+
+/*
+    KeyTable : intern - Retrieve the Keys for a list of strings, adding those that don't exist to the table
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKeys - The key strings to intern
+    param[out] pOut - The list that the interned Keys are appended to, in the same order as the strings
+
+    Note: The table is locked once for all of the strings, rather than for each of them
+*/
+void Utilities::Templates::KeyTable::intern(const std::vector<std::string>& pKeys, std::vector<Blackboard::Key>& pOut) {
+    //Lock the table exclusively to add any new entries
+    std::lock_guard<SharedRecursiveMutex> guard(mLock);
+
+    //Add each of the strings in turn
+    pOut.reserve(pOut.size() + pKeys.size());
+    for (const std::string& key : pKeys) {
+        auto found = mAtoms.find(key);
+        if (found == mAtoms.end()) {
+            found = mAtoms.emplace(key, (uint32_t)mAtoms.size()).first;
+            mTexts.push_back(&found->first);
+        }
+        pOut.push_back(Blackboard::Key(found->second, &found->first));
+    }
+}
+
+/*
+    KeyTable : find - Retrieve the Key for a string without adding it to the table
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key string to find
+
+    return Key - Returns the interned Key for the string or an invalid Key if it hasn't been interned
+*/
+Utilities::Blackboard::Key Utilities::Templates::KeyTable::find(std::string_view pKey) {
+    //Share the table with other threads
+    std::shared_lock<SharedRecursiveMutex> guard(mLock);
+
+    //Find the entry
+    auto found = findKey(mAtoms, pKey);
+    return (found != mAtoms.end() ? Blackboard::Key(found->second, &found->first) : Blackboard::Key());
+}
+
+/*
+    KeyTable : find - Retrieve the Key that was given an atom ID
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pID - The atom ID of the key
+
+    return Key - Returns the interned Key with the ID or an invalid Key if no string has been given it
+*/
+Utilities::Blackboard::Key Utilities::Templates::KeyTable::find(uint32_t pID) {
+    //Share the table with other threads
+    std::shared_lock<SharedRecursiveMutex> guard(mLock);
+
+    //Find the entry
+    return (pID < mTexts.size() ? Blackboard::Key(pID, mTexts[pID]) : Blackboard::Key());
+}
+
+/*
+    KeyTable : find - Retrieve the Keys that were given a list of atom IDs
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pIDs - The atom IDs of the keys
+    param[in] pCount - The number of IDs in the list
+    param[out] pOut - The list that the Key of each ID, or an invalid Key, is stored in
+*/
+void Utilities::Templates::KeyTable::find(const uint32_t* pIDs, size_t pCount, Blackboard::Key* pOut) {
+    //Share the table with other threads once for the whole list
+    std::shared_lock<SharedRecursiveMutex> guard(mLock);
+
+    //Find the entries
+    for (size_t i = 0; i < pCount; i++)
+        pOut[i] = (pIDs[i] < mTexts.size() ? Blackboard::Key(pIDs[i], mTexts[pIDs[i]]) : Blackboard::Key());
+}
+
+/*
+    CodecTable : get - Retrieve the process wide table of registered types
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return CodecTable& - Returns a reference to the table
+*/
+Utilities::Templates::CodecTable& Utilities::Templates::CodecTable::get() {
+    //Create the table the first time it is used
+    static CodecTable table;
+
+    //Return the table
+    return table;
+}
+
+/*
+    CodecTable : add - Register a type with the functions used to save and load its values
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pEntry - The description of the type to register
+
+    return bool - Returns true if the type was added, or false if the type or name is already registered
+*/
+bool Utilities::Templates::CodecTable::add(Entry pEntry) {
+    //Lock the table exclusively to add the entry
+    std::lock_guard<SharedRecursiveMutex> guard(mLock);
+
+    //Check that neither the type or name are in use
+    if ((pEntry.mType < mTypes.size() && mTypes[pEntry.mType]) || findKey(mNames, pEntry.mName) != mNames.end()) return false;
+
+    //Add the entry
+    const size_t type = pEntry.mType;
+    std::string name = pEntry.mName;
+    const Entry* entry = &mNames.emplace(std::move(name), std::move(pEntry)).first->second;
+    if (type >= mTypes.size()) mTypes.resize(type + 1, nullptr);
+    mTypes[type] = entry;
+    return true;
+}
+
+/*
+    CodecTable : find - Retrieve the registration of a type by its type ID
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pType - The type ID to find
+
+    return const Entry* - Returns a pointer to the registration or nullptr if the type isn't registered
+*/
+const Utilities::Templates::CodecTable::Entry* Utilities::Templates::CodecTable::find(size_t pType) {
+    //Share the table with other threads
+    std::shared_lock<SharedRecursiveMutex> guard(mLock);
+    return (pType < mTypes.size() ? mTypes[pType] : nullptr);
+}
+
+/*
+    CodecTable : find - Retrieve the registration of a type by the name it is saved with
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name to find
+
+    return const Entry* - Returns a pointer to the registration or nullptr if no type has the name
+*/
+const Utilities::Templates::CodecTable::Entry* Utilities::Templates::CodecTable::find(std::string_view pName) {
+    //Share the table with other threads
+    std::shared_lock<SharedRecursiveMutex> guard(mLock);
+    auto found = findKey(mNames, pName);
+    return (found != mNames.end() ? &found->second : nullptr);
+}
+
+/*
+    Teardown : get - Retrieve the process wide teardown thread
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return Teardown& - Returns a reference to the teardown thread
+
+    Note: The key table is created first so that it outlives a teardown that is joined at exit
+*/
+Utilities::Templates::Teardown& Utilities::Templates::Teardown::get() {
+    //Create the thread the first time it is used
+    KeyTable::get();
+    static Teardown teardown;
+
+    //Return the thread
+    return teardown;
+}
+
+/*
+    Teardown : run - Destroy a Board and the memory pool that it allocates from on the background thread
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pBoard - The Board to destroy, this must not be used by any other thread
+    param[in] pPool - The memory pool to destroy once the Board is gone, or nullptr if it has none
+*/
+void Utilities::Templates::Teardown::run(Blackboard::Board* pBoard, std::pmr::memory_resource* pPool) {
+    //Lock the thread
+    std::lock_guard<std::mutex> guard(mLock);
+
+    //Wait for the previous teardown to finish
+    if (mThread.joinable()) mThread.join();
+
+    //Start the teardown
+    mThread = std::thread([pBoard, pPool]() {
+        delete pBoard;
+        delete pPool;
+    });
+}
+
+/*
+    Teardown : wait - Wait for the current teardown to finish
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::Teardown::wait() {
+    //Lock the thread
+    std::lock_guard<std::mutex> guard(mLock);
+
+    //Join the thread if it is running
+    if (mThread.joinable()) mThread.join();
+}
+
+/*
+    ArchiveWriter : indexKey - Retrieve the key table index of a key, adding it to the table if it hasn't been written
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pID - The atom ID of the key
+
+    return uint32_t - Returns the index of the key within the key table of the archive
+*/
+uint32_t Utilities::Templates::ArchiveWriter::indexKey(uint32_t pID) {
+    //Ensure there is an index for the atom
+    if (pID >= mIndices.size()) mIndices.resize((size_t)pID + 1, 0);
+
+    //Add the key to the table the first time it is used
+    uint32_t& index = mIndices[pID];
+    if (!index) {
+        mKeys.push_back(pID);
+        index = (uint32_t)mKeys.size();
+    }
+    return index - 1;
+}
+
+/*
+    ArchiveReader : view - Retrieve a pointer to the next bytes of the archive
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pSize - The number of bytes to read
+
+    return const void* - Returns a pointer to the bytes or nullptr if the archive doesn't contain enough data
+
+    Note: Streamed bytes are read into a buffer that is reused, the pointer is only valid until the next read.
+          The buffer is grown as the bytes are read, so a size beyond the end of the stream doesn't allocate it
+*/
+const void* Utilities::Templates::ArchiveReader::view(size_t pSize) {
+    //Bytes in memory are used in place
+    if (!mStream) {
+        if (pSize > mSize - mOffset) return nullptr;
+        const char* data = mData + mOffset;
+        mOffset += pSize;
+        return data;
+    }
+
+    //Read the bytes from the stream a chunk at a time, the buffer always holds at least one byte so that empty views are valid
+    if (mBuffer.empty()) mBuffer.resize(1);
+    for (size_t read = 0; read < pSize;) {
+        const size_t chunk = std::min(pSize - read, StreamChunk);
+        if (mBuffer.size() < read + chunk) mBuffer.resize(read + chunk);
+        if (!mStream->read(mBuffer.data() + read, (std::streamsize)chunk)) return nullptr;
+        read += chunk;
+    }
+    mOffset += pSize;
+    return mBuffer.data();
+}
+
+/*
+    ArchiveReader : read - Copy the next bytes of the archive
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[out] pData - The location that the bytes are copied to
+    param[in] pSize - The number of bytes to read
+
+    return bool - Returns true if the archive contained enough data
+*/
+bool Utilities::Templates::ArchiveReader::read(void* pData, size_t pSize) {
+    //Copy the bytes out of memory
+    if (!mStream) {
+        const void* data = view(pSize);
+        if (data && pSize) std::memcpy(pData, data, pSize);
+        return (data != nullptr);
+    }
+
+    //Read the bytes from the stream directly
+    if (!mStream->read((char*)pData, (std::streamsize)pSize)) return false;
+    mOffset += pSize;
+    return true;
+}
+
+/*
+    ArchiveReader : readString - Read a string that was written with its length
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[out] pValue - The string that is read
+
+    return bool - Returns true if the archive contained the whole string
+*/
+bool Utilities::Templates::ArchiveReader::readString(std::string& pValue) {
+    //Read the length, followed by the characters
+    uint32_t length;
+    if (!read(length)) return false;
+    const char* data = (const char*)view(length);
+    if (!data) return false;
+    pValue.assign(data, length);
+    return true;
+}
+
+/*
+    ArchiveReader : skip - Move past the next bytes of the archive without reading them
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pSize - The number of bytes to skip
+
+    return bool - Returns true if the archive contained enough data
+*/
+bool Utilities::Templates::ArchiveReader::skip(size_t pSize) {
+    //Move through memory
+    if (!mStream) return (view(pSize) != nullptr);
+
+    //Discard the bytes from the stream
+    if (!mStream->ignore((std::streamsize)pSize) || (size_t)mStream->gcount() != pSize) return false;
+    mOffset += pSize;
+    return true;
+}
+
+/*
+    Key : Constructor - Intern a key string for use with the Blackboard
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key string to intern
+*/
+Utilities::Blackboard::Key::Key(std::string_view pKey) : Key(Templates::KeyTable::get().intern(pKey)) {}
+
+/*
+    EventQueue : push - Add a notification to the queue
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pNode - The notification to add, the queue takes ownership of it
+*/
+void Utilities::Templates::EventQueue::push(Node* pNode) {
+    //Link the node to the current head until it can be swapped in
+    pNode->mNext = mHead.load(std::memory_order_relaxed);
+    while (!mHead.compare_exchange_weak(pNode->mNext, pNode, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/*
+    EventQueue : takeAll - Remove all of the notifications from the queue
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return Node* - Returns the first of the notifications in the order that they were pushed, the caller takes ownership
+*/
+Utilities::Templates::EventQueue::Node* Utilities::Templates::EventQueue::takeAll() {
+    //Take the current list
+    Node* node = mHead.exchange(nullptr, std::memory_order_acquire);
+
+    //Reverse the list so notifications are in the order they were pushed
+    Node* ordered = nullptr;
+    while (node) {
+        Node* next = node->mNext;
+        node->mNext = ordered;
+        ordered = node;
+        node = next;
+    }
+    return ordered;
+}
+
+/*
+    EventQueue : clear - Discard all of the notifications in the queue
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::EventQueue::clear() {
+    //Delete the nodes
+    for (Node* node = takeAll(); node;) {
+        Node* next = node->mNext;
+        delete node;
+        node = next;
+    }
+}
+
+/*
+    TypeIndex : add - List a type as holding a record for a key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pID - The atom ID of the key
+    param[in] pType - The type ID of the Value map that holds the record
+*/
+void Utilities::Templates::TypeIndex::add(uint32_t pID, uint32_t pType) {
+    //Lock the stripe for the key
+    Stripe& stripe = getStripe(pID);
+    std::lock_guard<std::mutex> guard(stripe.mLock);
+
+    //Add the type if it isn't already listed
+    SmallVector<uint32_t, 2>& types = stripe.mTypes[pID];
+    for (uint32_t type : types)
+        if (type == pType) return;
+    types.push_back(pType);
+}
+
+/*
+    TypeIndex : remove - Remove a type from the list of those holding a record for a key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pID - The atom ID of the key
+    param[in] pType - The type ID of the Value map that no longer holds the record
+*/
+void Utilities::Templates::TypeIndex::remove(uint32_t pID, uint32_t pType) {
+    //Lock the stripe for the key
+    Stripe& stripe = getStripe(pID);
+    std::lock_guard<std::mutex> guard(stripe.mLock);
+
+    //Find the types of the key
+    auto found = stripe.mTypes.find(pID);
+    if (found == stripe.mTypes.end()) return;
+
+    //Remove the type, erasing the entry once the key has no types
+    SmallVector<uint32_t, 2>& types = found->second;
+    for (size_t i = 0; i < types.size(); i++) {
+        if (types[i] == pType) {
+            types.erase(i);
+            break;
+        }
+    }
+    if (types.empty()) stripe.mTypes.erase(found);
+}
+
+/*
+    TypeIndex : find - Retrieve the types that hold a record for a key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pID - The atom ID of the key
+    param[out] pOut - The list that the type IDs are copied into
+*/
+void Utilities::Templates::TypeIndex::find(uint32_t pID, SmallVector<uint32_t, 8>& pOut) {
+    //Lock the stripe for the key
+    Stripe& stripe = getStripe(pID);
+    std::lock_guard<std::mutex> guard(stripe.mLock);
+
+    //Copy the types out
+    auto found = stripe.mTypes.find(pID);
+    if (found != stripe.mTypes.end()) pOut.assign(found->second.begin(), found->second.end());
+    else pOut.clear();
+}
+
+/*
+    TimerWheel : place - Add a timer to the slot that it is next handled in
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pTimer - The timer to add
+
+    Note: This function must be called with the wheel locked. Timers beyond the span of the highest
+          level are placed in it by their wrapped slot and placed again each time that slot is reached
+*/
+void Utilities::Templates::TimerWheel::place(const Timer& pTimer) {
+    //Timers that are already due are expired by the next advance
+    if (pTimer.mDeadline <= mNow) {
+        mDue.push_back(pTimer);
+        return;
+    }
+
+    //Find the lowest level that spans the time until the timer expires
+    const uint64_t remaining = pTimer.mDeadline - mNow;
+    size_t level = 0;
+    while (level + 1 < LEVEL_COUNT && remaining >= (uint64_t(1) << ((level + 1) * SLOT_BITS))) ++level;
+
+    //Add the timer to the slot of the level that its deadline falls in
+    mSlots[level][(pTimer.mDeadline >> (level * SLOT_BITS)) & (SLOT_COUNT - 1)].push_back(pTimer);
+    ++mCounts[level];
+}
+
+/*
+    TimerWheel : schedule - Add a timer that expires after a lifetime from the current time of the wheel
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pMap - The Value map that holds the value
+    param[in] pID - The atom ID of the key of the value
+    param[in] pLifetime - The number of milliseconds until the value expires
+
+    return uint64_t - Returns the deadline of the timer, this is never 0
+*/
+uint64_t Utilities::Templates::TimerWheel::schedule(BaseMap* pMap, uint32_t pID, uint64_t pLifetime) {
+    //Lock the wheel
+    std::lock_guard<std::mutex> guard(mLock);
+
+    //Find the deadline, keeping it clear of the value used for values that don't expire
+    const uint64_t deadline = std::max<uint64_t>(pLifetime > UINT64_MAX - mNow ? UINT64_MAX : mNow + pLifetime, 1);
+    place({ deadline, pMap, pID });
+    return deadline;
+}
+
+/*
+    TimerWheel : advance - Move the current time of the wheel forward, taking the timers that expire
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pNow - The new current time, times earlier than the current time are ignored
+    param[out] pOut - The list that the expired timers are appended to
+
+    Note: Times where none of the slots are reached are skipped over, so the cost depends on the
+          number of timers that are moved or expired rather than the length of time that passed
+*/
+void Utilities::Templates::TimerWheel::advance(uint64_t pNow, std::vector<Timer>& pOut) {
+    //Lock the wheel
+    std::lock_guard<std::mutex> guard(mLock);
+
+    while (mNow < pNow) {
+        //Find the lowest level that holds timers
+        size_t level = 0;
+        while (level < LEVEL_COUNT && !mCounts[level]) ++level;
+        if (level == LEVEL_COUNT) {
+            mNow = pNow;
+            break;
+        }
+
+        //Skip to the next time that a slot of the level is reached
+        const size_t shift = level * SLOT_BITS;
+        const uint64_t next = ((mNow >> shift) + 1) << shift;
+        if (next > pNow) {
+            mNow = pNow;
+            break;
+        }
+        mNow = next;
+
+        //Move the timers of the slots that have been reached down a level, starting from the highest
+        for (size_t i = LEVEL_COUNT - 1; i > 0; --i) {
+            if (mNow & ((uint64_t(1) << (i * SLOT_BITS)) - 1)) continue;
+            std::vector<Timer> timers;
+            timers.swap(mSlots[i][(mNow >> (i * SLOT_BITS)) & (SLOT_COUNT - 1)]);
+            mCounts[i] -= timers.size();
+            for (const Timer& timer : timers) place(timer);
+        }
+
+        //Expire the timers of the current slot
+        std::vector<Timer> timers;
+        timers.swap(mSlots[0][mNow & (SLOT_COUNT - 1)]);
+        mCounts[0] -= timers.size();
+        for (const Timer& timer : timers) place(timer);
+    }
+
+    //Take the timers that are due
+    pOut.insert(pOut.end(), mDue.begin(), mDue.end());
+    mDue.clear();
+}
+
+/*
+    TimerWheel : clear - Remove all of the timers, keeping the current time
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Templates::TimerWheel::clear() {
+    //Lock the wheel
+    std::lock_guard<std::mutex> guard(mLock);
+
+    //Empty each of the slots, keeping their capacity
+    for (size_t level = 0; level < LEVEL_COUNT; level++) {
+        for (std::vector<Timer>& slot : mSlots[level]) slot.clear();
+        mCounts[level] = 0;
+    }
+    mDue.clear();
+}
+
+/*
+    sharedName - Convert the name of a shared region into the name used by the platform
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name of the region
+
+    return std::string - Returns the platform name, POSIX names start with a single '/'
+*/
+static std::string sharedName(std::string_view pName) {
+#ifdef _WIN32
+    return std::string(pName);
+#else
+    return (!pName.empty() && pName[0] == '/' ? std::string(pName) : "/" + std::string(pName));
+#endif
+}
+
+/*
+    Blackboard::SharedRegion : create - Create a new shared region and map it into this process
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name that other processes open the region with
+    param[in] pCapacity - The number of keys the index can hold, rounded up to a power of two (Default 4096)
+    param[in] pDataSize - The number of bytes available for the keys and values (Default 1MB)
+
+    return bool - Returns true if the region was created, or false if a region with the name already exists
+
+    Note: A region left behind by a process that didn't close it can be removed with SharedRegion::remove
+*/
+bool Utilities::Blackboard::SharedRegion::create(std::string_view pName, uint32_t pCapacity, size_t pDataSize) {
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free, "Shared regions require lock free atomics");
+    static_assert(sizeof(Header) <= Alignment, "The region header must fit within its alignment");
+
+    //Release the current region
+    close();
+
+    //Round the capacity up to a power of two so that the index can be masked
+    uint32_t capacity = 16;
+    while (capacity < pCapacity && capacity < (1u << 30)) capacity <<= 1;
+    const size_t size = getLayoutSize(capacity, pDataSize);
+    const std::string name = sharedName(pName);
+
+    //Create the mapping, failing if it already exists
+#ifdef _WIN32
+    HANDLE handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)(size & 0xFFFFFFFF), name.c_str());
+    if (!handle) return false;
+    if (GetLastError() == ERROR_ALREADY_EXISTS) {
+        CloseHandle(handle);
+        return false;
+    }
+    void* base = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!base) {
+        CloseHandle(handle);
+        return false;
+    }
+    mHandle = (intptr_t)handle;
+#else
+    const int file = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (file < 0) return false;
+    void* base = (ftruncate(file, (off_t)size) == 0 ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0) : MAP_FAILED);
+    if (base == MAP_FAILED) {
+        ::close(file);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    mHandle = file;
+#endif
+    mBase = base;
+    mSize = size;
+    mName = name;
+    mOwner = true;
+
+    //Construct the header and the index in the zeroed memory
+    Header* header = new (mBase) Header();
+    std::memcpy(header->mMagic, Magic, sizeof(Magic));
+    header->mVersion = Version;
+    header->mCapacity = capacity;
+    header->mDataSize = pDataSize;
+    header->mDataUsed.store(0, std::memory_order_relaxed);
+    header->mCount.store(0, std::memory_order_relaxed);
+    Entry* entries = getEntries();
+    for (uint32_t i = 0; i < capacity; i++)
+        new (entries + i) Entry();
+
+    //Flag the region as ready to be opened
+    header->mState.store(STATE_READY, std::memory_order_release);
+    return true;
+}
+
+/*
+    Blackboard::SharedRegion : open - Map a shared region that was created by another process
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name that the region was created with
+
+    return bool - Returns true if the region was opened, or false if it doesn't exist or wasn't created by a compatible version
+*/
+bool Utilities::Blackboard::SharedRegion::open(std::string_view pName) {
+    //Release the current region
+    close();
+    const std::string name = sharedName(pName);
+
+    //Map the whole of the region
+#ifdef _WIN32
+    HANDLE handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+    if (!handle) return false;
+    void* base = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION info;
+    if (!base || !VirtualQuery(base, &info, sizeof(info))) {
+        if (base) UnmapViewOfFile(base);
+        CloseHandle(handle);
+        return false;
+    }
+    mHandle = (intptr_t)handle;
+    mSize = (size_t)info.RegionSize;
+#else
+    const int file = shm_open(name.c_str(), O_RDWR, 0);
+    if (file < 0) return false;
+    struct stat info;
+    void* base = (fstat(file, &info) == 0 && (size_t)info.st_size >= Alignment ? mmap(nullptr, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0) : MAP_FAILED);
+    if (base == MAP_FAILED) {
+        ::close(file);
+        return false;
+    }
+    mHandle = file;
+    mSize = (size_t)info.st_size;
+#endif
+    mBase = base;
+    mName = name;
+    mOwner = false;
+
+    //Check that the region is complete and has the expected layout
+    const Header* header = getHeader();
+    if (header->mState.load(std::memory_order_acquire) != STATE_READY || std::memcmp(header->mMagic, Magic, sizeof(Magic)) ||
+        header->mVersion != Version || (header->mCapacity & (header->mCapacity - 1)) || getLayoutSize(header->mCapacity, header->mDataSize) > mSize) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+/*
+    Blackboard::SharedRegion : close - Unmap the region, removing it if this object created it
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Blackboard::SharedRegion::close() {
+    //Check there is a region to close
+    if (!mBase) return;
+
+    //Release the mapping
+#ifdef _WIN32
+    UnmapViewOfFile(mBase);
+    CloseHandle((HANDLE)mHandle);
+#else
+    munmap(mBase, mSize);
+    ::close((int)mHandle);
+    if (mOwner) shm_unlink(mName.c_str());
+#endif
+    mBase = nullptr;
+    mSize = 0;
+    mHandle = -1;
+    mName.clear();
+    mOwner = false;
+}
+
+/*
+    Blackboard::SharedRegion : remove - Remove a region that was left behind by a process that didn't close it
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name of the region
+
+    return bool - Returns true if a region was removed
+
+    Note: Regions are released by the system once no process has them open on Windows, so this has no effect there
+*/
+bool Utilities::Blackboard::SharedRegion::remove(std::string_view pName) {
+#ifdef _WIN32
+    (void)pName;
+    return false;
+#else
+    return (shm_unlink(sharedName(pName).c_str()) == 0);
+#endif
+}
+
+/*
+    Blackboard::SharedRegion : findSlot - Find the slot of a value, adding the key to the index if requested
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The text of the key
+    param[in] pType - The name that the type of the value was registered with
+    param[in] pSize - The size of the value in bytes
+    param[in] pCreate - A flag to indicate if the key should be added if it isn't found
+
+    return Slot* - Returns a pointer to the slot, or nullptr if it wasn't found or couldn't be added
+
+    Note: Keys are added by claiming an empty entry of the index and then reserving their slot, so
+          readers and writers of the key in other processes wait for the entry to be completed. The
+          entries can be changed by any process that maps the region, so their offsets are checked
+          against the data area before they are used. A key that was added with a different size for
+          the same type is treated as missing
+*/
+Utilities::Blackboard::SharedRegion::Slot* Utilities::Blackboard::SharedRegion::findSlot(std::string_view pKey, std::string_view pType, uint32_t pSize, bool pCreate) {
+    //Check the region is open
+    if (!mBase) return nullptr;
+    Header* header = getHeader();
+    Entry* entries = getEntries();
+
+    //Take the layout once and check that it still fits the mapping
+    const uint32_t capacity = header->mCapacity;
+    if (!capacity || (capacity & (capacity - 1)) || getDataOffset(capacity) > mSize) return nullptr;
+    char* data = getData(capacity);
+    const uint64_t dataSize = std::min<uint64_t>(header->mDataSize, mSize - getDataOffset(capacity));
+
+    //Hash the key and type names, separated so that they can't run together
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : pKey) hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+    hash = (hash ^ 0xFF) * 1099511628211ull;
+    for (char c : pType) hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+
+    //Get the size of the slot of the value and of the block that holds it with the names of the key
+    const size_t words = (pSize + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    const uint64_t slotSize = sizeof(Slot) + words * sizeof(uint64_t);
+    const uint32_t nameLength = (uint32_t)(pKey.size() + 1 + pType.size());
+    const uint64_t bytes = (slotSize + nameLength + Alignment - 1) / Alignment * Alignment;
+
+    //Probe the index from the position of the hash
+    const uint32_t mask = capacity - 1;
+    for (uint32_t i = 0; i <= mask; i++) {
+        Entry& entry = entries[(hash + i) & mask];
+        uint32_t state = entry.mState.load(std::memory_order_acquire);
+
+        //Wait for the entry to be completed, claiming it for the key if it is empty
+        while (state != STATE_READY) {
+            if (state == STATE_CLAIMED) {
+                std::this_thread::yield();
+                state = entry.mState.load(std::memory_order_acquire);
+                continue;
+            }
+            if (!pCreate) return nullptr;
+            if (!entry.mState.compare_exchange_strong(state, STATE_CLAIMED, std::memory_order_acquire, std::memory_order_acquire)) continue;
+
+            //Reserve the slot and names of the key without moving the used size past the end of the data area
+            uint64_t offset = header->mDataUsed.load(std::memory_order_relaxed);
+            do {
+                if (offset > dataSize || bytes > dataSize - offset) {
+                    //Return the entry so that smaller values can still be added
+                    entry.mState.store(STATE_EMPTY, std::memory_order_release);
+                    return nullptr;
+                }
+            } while (!header->mDataUsed.compare_exchange_weak(offset, offset + bytes, std::memory_order_relaxed));
+
+            //Construct the empty value, followed by the key and type names
+            Slot* slot = new (data + offset) Slot();
+            slot->mSize = pSize;
+            std::atomic<uint64_t>* values = (std::atomic<uint64_t>*)(slot + 1);
+            for (size_t w = 0; w < words; w++) new (values + w) std::atomic<uint64_t>(0);
+            char* name = (char*)(values + words);
+            std::memcpy(name, pKey.data(), pKey.size());
+            name[pKey.size()] = '\0';
+            std::memcpy(name + pKey.size() + 1, pType.data(), pType.size());
+
+            //Publish the entry
+            entry.mNameLength = nameLength;
+            entry.mHash = hash;
+            entry.mName = offset + slotSize;
+            entry.mSlot = offset;
+            entry.mState.store(STATE_READY, std::memory_order_release);
+            header->mCount.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+        }
+
+        //Check if the entry is for the key, skipping entries whose names lie outside of the data area
+        if (entry.mHash != hash || entry.mNameLength != nameLength) continue;
+        const uint64_t nameOffset = entry.mName;
+        if (nameOffset > dataSize || nameLength > dataSize - nameOffset) continue;
+        const char* name = data + nameOffset;
+        if (std::memcmp(name, pKey.data(), pKey.size()) || name[pKey.size()] != '\0' || std::memcmp(name + pKey.size() + 1, pType.data(), pType.size())) continue;
+
+        //Check that the slot lies within the data area before using it
+        const uint64_t slotOffset = entry.mSlot;
+        if ((slotOffset % Alignment) || slotOffset > dataSize || slotSize > dataSize - slotOffset) return nullptr;
+        Slot* slot = (Slot*)(data + slotOffset);
+        return (slot->mSize == pSize ? slot : nullptr);
+    }
+    return nullptr;
+}
+
+/*
+    Blackboard::SharedRegion : write - Write the bytes of a value to a key of the region
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The text of the key
+    param[in] pType - The name that the type of the value was registered with
+    param[in] pValue - The bytes of the value
+    param[in] pSize - The size of the value in bytes
+
+    return bool - Returns true if the value was written
+*/
+bool Utilities::Blackboard::SharedRegion::write(std::string_view pKey, std::string_view pType, const void* pValue, uint32_t pSize) {
+    //Find the slot of the key, adding it if needed
+    Slot* slot = findSlot(pKey, pType, pSize, true);
+    if (!slot) return false;
+
+    //Take the slot from any other writers
+    uint32_t sequence = slot->mSequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (sequence & SEQUENCE_WRITING) {
+            std::this_thread::yield();
+            sequence = slot->mSequence.load(std::memory_order_relaxed);
+        }
+        else if (slot->mSequence.compare_exchange_weak(sequence, sequence | SEQUENCE_WRITING, std::memory_order_acquire, std::memory_order_relaxed)) break;
+    }
+
+    //Copy the value across a word at a time
+    std::atomic<uint64_t>* values = (std::atomic<uint64_t>*)(slot + 1);
+    for (uint32_t offset = 0; offset < pSize; offset += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, (const char*)pValue + offset, std::min<size_t>(sizeof(uint64_t), pSize - offset));
+        values[offset / sizeof(uint64_t)].store(word, std::memory_order_release);
+    }
+
+    //Release the slot with the value present
+    slot->mSequence.store(((sequence | (SEQUENCE_STEP - 1)) + 1) | SEQUENCE_PRESENT, std::memory_order_release);
+    return true;
+}
+
+/*
+    Blackboard::SharedRegion : read - Copy the bytes of the value of a key out of the region
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The text of the key
+    param[in] pType - The name that the type of the value was registered with
+    param[out] pOut - The buffer that the value is copied into, this may be changed even if the value isn't found
+    param[in] pSize - The size of the value in bytes
+
+    return bool - Returns true if the key had a value that was copied
+*/
+bool Utilities::Blackboard::SharedRegion::read(std::string_view pKey, std::string_view pType, void* pOut, uint32_t pSize) {
+    //Find the slot of the key
+    const Slot* slot = findSlot(pKey, pType, pSize, false);
+    if (!slot) return false;
+
+    //Copy the value until a copy is made without a write overlapping it
+    const std::atomic<uint64_t>* values = (const std::atomic<uint64_t>*)(slot + 1);
+    for (;;) {
+        const uint32_t sequence = slot->mSequence.load(std::memory_order_acquire);
+        if (sequence & SEQUENCE_WRITING) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (!(sequence & SEQUENCE_PRESENT)) return false;
+        for (uint32_t offset = 0; offset < pSize; offset += sizeof(uint64_t)) {
+            const uint64_t word = values[offset / sizeof(uint64_t)].load(std::memory_order_acquire);
+            std::memcpy((char*)pOut + offset, &word, std::min<size_t>(sizeof(uint64_t), pSize - offset));
+        }
+        if (slot->mSequence.load(std::memory_order_relaxed) == sequence) return true;
+    }
+}
+
+/*
+    Blackboard::SharedRegion : erase - Mark the value of a key in the region as absent
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The text of the key
+    param[in] pType - The name that the type of the value was registered with
+    param[in] pSize - The size of the value in bytes
+
+    return bool - Returns true if the key had a value that was erased
+
+    Note: The key stays in the index, so it can be written again without allocating
+*/
+bool Utilities::Blackboard::SharedRegion::erase(std::string_view pKey, std::string_view pType, uint32_t pSize) {
+    //Find the slot of the key
+    Slot* slot = findSlot(pKey, pType, pSize, false);
+    if (!slot) return false;
+
+    //Take the slot from any other writers
+    uint32_t sequence = slot->mSequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (sequence & SEQUENCE_WRITING) {
+            std::this_thread::yield();
+            sequence = slot->mSequence.load(std::memory_order_relaxed);
+        }
+        else if (slot->mSequence.compare_exchange_weak(sequence, sequence | SEQUENCE_WRITING, std::memory_order_acquire, std::memory_order_relaxed)) break;
+    }
+
+    //Release the slot without the value
+    slot->mSequence.store((sequence | (SEQUENCE_STEP - 1)) + 1, std::memory_order_release);
+    return (sequence & SEQUENCE_PRESENT) != 0;
+}
+
+/*
+    Blackboard : create - Initialise the Blackboard singleton for use
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pPooled - Flags if the Board allocates from a memory pool of its own, so that its memory
+                        is returned in large blocks when it is destroyed (Default false)
+
+    return bool - Returns true if the Blackboard was initialised successfully
+*/
+bool Utilities::Blackboard::create(bool pPooled) {
+    //Check if the Blackboard has already been set up
+    if (isReady()) destroy();
+
+    //Create the pool for the instance
+    if (pPooled) mPool = new std::pmr::synchronized_pool_resource();
+
+    //Create the instance
+    mInstance = new Board(mPool ? mPool : std::pmr::get_default_resource());
+
+    //Return success state
+    return (mInstance != nullptr);
+}
+
+/*
+    Blackboard : destroy - Deallocate all data associated with the Blackboard and destroy
+                           the singleton instance
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pBackground - Flags if the Board is destroyed on a background thread, the singleton can be
+                            created again straight away (Default false)
+
+    Note: Only one background teardown runs at a time, a second waits for the first to finish
+*/
+void Utilities::Blackboard::destroy(bool pBackground) {
+    //Take the singleton and its pool, this invalidates all previously resolved Handles
+    Board* board = mInstance;
+    std::pmr::memory_resource* pool = mPool;
+    mInstance = nullptr;
+    mPool = nullptr;
+
+    //Delete the singleton and then its pool
+    if (pBackground && board) Templates::Teardown::get().run(board, pool);
+    else {
+        delete board;
+        delete pool;
+    }
+}
+
+/*
+    Blackboard : waitForTeardown - Wait for the Board destroyed on a background thread to finish being released
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Blackboard::waitForTeardown() { Templates::Teardown::get().wait(); }
+
+/*
+    Blackboard : wipeKey - Clear all data associated with the passed in key value
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pKey - A string object containing the key of the value(s) to remove
+*/
+void Utilities::Blackboard::wipeKey(std::string_view pKey) { getBoard().wipeKey(pKey); }
+
+/*
+    Blackboard : wipeKey - Clear all data associated with the passed in interned Key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The Key of the value(s) to remove
+*/
+void Utilities::Blackboard::wipeKey(const Key& pKey) { getBoard().wipeKey(pKey); }
+
+/*
+    Blackboard : wipeBoard - Clear all data stored on the Blackboard
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pWipeCallbacks - Flags if all of the set event callbacks should be cleared
+                               as well as the values (Default false)
+*/
+void Utilities::Blackboard::wipeBoard(bool pWipeCallbacks) { getBoard().wipeBoard(pWipeCallbacks); }
+
+/*
+    Blackboard : unsubscribe - Remove a single callback event using the token returned when it was subscribed
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pSubscription - The token of the callback event to remove
+*/
+void Utilities::Blackboard::unsubscribe(const Subscription& pSubscription) { getBoard().unsubscribe(pSubscription); }
+
+/*
+    Blackboard : unsubscribeAll - Remove the associated callback events for a key
+                                  from every type map 
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pKey - The key to remove the callback events from
+*/
+void Utilities::Blackboard::unsubscribeAll(std::string_view pKey) { getBoard().unsubscribeAll(pKey); }
+
+/*
+    Blackboard : unsubscribeAll - Remove the associated callback events for an interned Key
+                                  from every type map 
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key to remove the callback events from
+*/
+void Utilities::Blackboard::unsubscribeAll(const Key& pKey) { getBoard().unsubscribeAll(pKey); }
+
+/*
+    Blackboard : setDeferredEvents - Set if callback events are raised when values are written or queued
+                                     until flushEvents is called
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pDefer - Flags if callback events should be deferred
+
+    Note: Turning deferral off raises any events that are still queued
+*/
+void Utilities::Blackboard::setDeferredEvents(bool pDefer) { getBoard().setDeferredEvents(pDefer); }
+
+/*
+    Blackboard : flushEvents - Raise the callback events of all keys that have changed since the last flush
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the number of notifications that were processed
+
+    Note: Repeated writes to a key between flushes raise its events once, with the value at the time
+          of the flush. Events queued by callbacks during the flush are raised by the next flush
+*/
+size_t Utilities::Blackboard::flushEvents() { return getBoard().flushEvents(); }
+
+/*
+    Blackboard : tick - Move the time of the singleton Board forward, erasing the values whose lifetime has ended
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pNow - The current time, read from any clock that doesn't run backwards
+    param[in] pRaiseCallbacks - A flag to indicate if the subscribers of erased values are raised with the expired value (Default true)
+
+    return size_t - Returns the number of values that were erased
+*/
+size_t Utilities::Blackboard::tick(std::chrono::milliseconds pNow, bool pRaiseCallbacks) { return getBoard().tick(pNow, pRaiseCallbacks); }
+
+/*
+    Blackboard : setSnapshotMode - Set if the singleton Board tracks the keys that change so that snapshots can be published
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pEnabled - Flags if snapshot mode should be enabled
+*/
+void Utilities::Blackboard::setSnapshotMode(bool pEnabled) { getBoard().setSnapshotMode(pEnabled); }
+
+/*
+    Blackboard : publish - Make the current values of the singleton Board available to Snapshot readers
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the frame number of the published Snapshot, or 0 if snapshot mode isn't enabled
+*/
+size_t Utilities::Blackboard::publish() { return getBoard().publish(); }
+
+/*
+    Blackboard : changedSince - Find the keys of every type that have changed on the singleton Board since a version
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pVersion - The first version to include the changes of, 0 includes every change
+    param[out] pOut - The list that the keys that changed are appended to
+
+    return uint64_t - Returns the version to pass to the next call
+*/
+uint64_t Utilities::Blackboard::changedSince(uint64_t pVersion, std::vector<Key>& pOut) { return getBoard().changedSince(pVersion, pOut); }
+
+/*
+    Blackboard : save - Write the values of the registered types on the singleton Board to a binary archive
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pStream - The stream that the archive is written to
+
+    return bool - Returns true if the archive was written successfully
+*/
+bool Utilities::Blackboard::save(std::ostream& pStream) { return getBoard().save(pStream); }
+
+/*
+    Blackboard : load - Read the values of a binary archive from a stream onto the singleton Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pStream - The stream that the archive is read from
+    param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default false)
+
+    return bool - Returns true if the archive was read successfully
+*/
+bool Utilities::Blackboard::load(std::istream& pStream, bool pRaiseCallbacks) { return getBoard().load(pStream, pRaiseCallbacks); }
+
+/*
+    Blackboard : load - Read the values of a binary archive in memory onto the singleton Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pData - The start of the archive, such as a mapped file
+    param[in] pSize - The size of the archive in bytes
+    param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default false)
+
+    return bool - Returns true if the archive was read successfully
+*/
+bool Utilities::Blackboard::load(const void* pData, size_t pSize, bool pRaiseCallbacks) { return getBoard().load(pData, pSize, pRaiseCallbacks); }
+
+/*
+    Blackboard : getStats - Retrieve the access statistics of the singleton Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[out] pOut - The object that the statistics are copied into
+*/
+void Utilities::Blackboard::getStats(Stats& pOut) { getBoard().getStats(pOut); }
+
+/*
+    Blackboard : resetStats - Reset the access statistics of the singleton Board to 0
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void Utilities::Blackboard::resetStats() { getBoard().resetStats(); }
+
+/*
+    Blackboard : dumpStats - Write a summary of the access statistics of the singleton Board to a stream
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pStream - The stream that the summary is written to
+*/
+void Utilities::Blackboard::dumpStats(std::ostream& pStream) { getBoard().dumpStats(pStream); }
+
+/*
+    Blackboard : dumpStats - Pass the access statistics of the singleton Board to a callback
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pCallback - The function that is passed the statistics
+    param[in] pUserData - The user data that is passed to the callback (Default nullptr)
+*/
+void Utilities::Blackboard::dumpStats(StatsCallback pCallback, void* pUserData) { getBoard().dumpStats(pCallback, pUserData); }
+
+/*
+    Blackboard::Batch : Destructor - Apply any writes that haven't been committed
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+Utilities::Blackboard::Batch::~Batch() { commit(); }
+
+/*
+    Blackboard::Batch : commit - Apply all of the writes that have been added to the Batch
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the number of writes that were applied
+
+    Note: The writes of each type are applied in the order that the types were first written to,
+          and callback events are raised once the writes of their type have been applied
+*/
+size_t Utilities::Blackboard::Batch::commit() {
+    //Apply the writes of each of the types in turn
+    size_t count = 0;
+    for (auto& writes : mTypes)
+        count += writes->apply(*mBoard, mRaiseCallbacks);
+    return count;
+}
+
+/*
+    Blackboard::Batch : size - Get the number of writes that are waiting to be committed
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the number of writes
+*/
+size_t Utilities::Blackboard::Batch::size() const {
+    //Total the writes of each of the types
+    size_t count = 0;
+    for (const auto& writes : mTypes)
+        count += writes->size();
+    return count;
+}
+
+/*
+    Blackboard::Board : Constructor - Initialise an empty Board that allocates from a memory resource
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pResource - The memory resource that the Value maps and their containers are allocated from,
+                          this must outlive the Board (Default std::pmr::get_default_resource())
+*/
+Utilities::Blackboard::Board::Board(std::pmr::memory_resource* pResource) : Board(nullptr, pResource) {}
+
+/*
+    Blackboard::Board : Constructor - Initialise an empty Board that falls back to a parent Board when reading
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pParent - The Board that reads fall back to when a key isn't held by this Board, this must outlive
+                        the Board
+    param[in] pResource - The memory resource that the Value maps and their containers are allocated from,
+                          this must outlive the Board (Default std::pmr::get_default_resource())
+*/
+Utilities::Blackboard::Board::Board(Board* pParent, std::pmr::memory_resource* pResource) : mResource(pResource), mDataStorage(pResource), mEpoch(++mEpochCounter), mParent(pParent), mLayout(0), mScopeCache(pResource), mSnapshotting(false), mFrames{ Templates::SnapshotFrame(pResource), Templates::SnapshotFrame(pResource) }, mFront(nullptr), mPublishCount(0), mVersion(1), mTypeIndex(pResource) { BLACKBOARD_STAT(mDataLock.setStats(&mRegistryStats);) }
+
+/*
+    Blackboard::Board : Destructor - Deallocate all data associated with the Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+Utilities::Blackboard::Board::~Board() {
+    //Discard the deferred notifications that reference the Value Maps
+    mEventQueue.clear();
+
+    //Lock the data values
+    std::lock_guard<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+    //Return all Value Maps to the memory resource
+    for (auto map : mDataStorage)
+        if (map) map->release();
+}
+
+/*
+    Blackboard::Board : wipeKey - Clear all data associated with the passed in key value
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pKey - A string object containing the key of the value(s) to remove
+*/
+void Utilities::Blackboard::Board::wipeKey(std::string_view pKey) {
+    //Find the interned key without adding it
+    Key key = Templates::KeyTable::get().find(pKey);
+
+    //Wipe the key if it exists
+    if (key.isValid()) wipeKey(key);
+}
+
+/*
+    Blackboard::Board : wipeKey - Clear all data associated with the passed in interned Key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The Key of the value(s) to remove
+*/
+void Utilities::Blackboard::Board::wipeKey(const Key& pKey) {
+    //Ensure that the key is valid
+    assert(pKey.isValid());
+
+    //Find the types that hold the key
+    Templates::SmallVector<uint32_t, 8> types;
+    mTypeIndex.find(pKey.getID(), types);
+    if (types.empty()) return;
+
+    //Lock the type registry, each Value map locks its own data
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+    //Wipe the key from each of the types
+    for (uint32_t type : types)
+        if (type < mDataStorage.size() && mDataStorage[type]) mDataStorage[type]->wipeKey(pKey);
+}
+
+/*
+    Blackboard::Board : wipeBoard - Clear all data stored on the Blackboard
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
+
+    param[in] pWipeCallbacks - Flags if all of the set event callbacks should be cleared
+                               as well as the values (Default false)
+*/
+void Utilities::Blackboard::Board::wipeBoard(bool pWipeCallbacks) {
+    //Lock the type registry, each Value map locks its own data
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+    //Drop the timers of the values before they are erased, so that a lifetime written during the wipe keeps its timer
+    mTimers.clear();
+
+    //Clear the data values, and the callbacks if requested, of each Value map in a single pass
+    for (auto map : mDataStorage)
+        if (map) map->wipeAll(pWipeCallbacks);
+}
+
+/*
+    Blackboard::Board : unsubscribe - Remove a single callback event using the token returned when it was subscribed
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pSubscription - The token of the callback event to remove
+*/
+void Utilities::Blackboard::Board::unsubscribe(const Subscription& pSubscription) {
+    //Ignore tokens that are empty or from a previous Blackboard
+    if (!pSubscription.isValid() || pSubscription.mEpoch != mEpoch) return;
+
+    //Lock the type registry, each Value map locks its own data
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+
+    //Remove the subscriber from the Value map of its type
+    if (pSubscription.mType < mDataStorage.size() && mDataStorage[pSubscription.mType])
+        mDataStorage[pSubscription.mType]->removeSubscriber(pSubscription.mKey, pSubscription.mID);
+}
+
+/*
+    Blackboard::Board : unsubscribeAll - Remove the associated callback events for a key
+                                  from every type map 
+    Author: Mitchell Croft
+    Created: 08/11/2016
+    Modified: 14/10/2026
 
-            //! Privatise the constructor/destructor to prevent external use
-            BaseMap() = default; 
-            virtual ~BaseMap() = 0; 
+    param[in] pKey - The key to remove the callback events from
+*/
+void Utilities::Blackboard::Board::unsubscribeAll(std::string_view pKey) {
+    //Find the interned key without adding it
+    Key key = Templates::KeyTable::get().find(pKey);
 
-            //! Provide virtual methods for wiping keyed information
-            inline virtual void wipeKey(const std::string& pKey) = 0;
-            inline virtual void wipeAll() = 0;
-            inline virtual void unsubscribe(const std::string& pKey) = 0;
-            inline virtual void clearAllEvents() = 0;
-        };
+    //Unsubscribe the key if it exists
+    if (key.isValid()) unsubscribeAll(key);
+}
 
-        //! Define the default destructor for the BaseMap's pure virtual destructor
-        inline BaseMap::~BaseMap() {}
+/*
+    Blackboard::Board : unsubscribeAll - Remove the associated callback events for an interned Key
+                                  from every type map 
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        /*
-         *      Name: ValueMap (General)
-         *      Author: Mitchell Croft
-         *      Created: 08/11/2016
-         *      Modified: 08/11/2016
-         *      
-         *      Purpose:
-         *      Store templated data type information for recollection
-         *      and use within the Blackboard singleton object
-        **/
-        template<typename T>
-        class ValueMap : BaseMap {
-        protected:
-            //! Set the Value map to be a friend of the blackboard to allow for construction/destruction of the object
-            friend class Blackboard;
+    param[in] pKey - The key to remove the callback events from
+*/
+void Utilities::Blackboard::Board::unsubscribeAll(const Key& pKey) {
+    //Ensure that the key is valid
+    assert(pKey.isValid());
 
-            /*----------Variables----------*/
+    //Find the types that hold the key
+    Templates::SmallVector<uint32_t, 8> types;
+    mTypeIndex.find(pKey.getID(), types);
+    if (types.empty()) return;
 
-            //! Store a map of the values for this type
-            std::unordered_map<std::string, T> mValues;
+    //Lock the type registry, each Value map locks its own data
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
 
-            //! Store maps for the callback events 
-            std::unordered_map<std::string, EventKeyCallback<T>> mKeyEvents;
-            std::unordered_map<std::string, EventValueCallback<T>> mValueEvents;
-            std::unordered_map<std::string, EventKeyValueCallback<T>> mPairEvents;
+    //Remove the callbacks from each of the types
+    for (uint32_t type : types)
+        if (type < mDataStorage.size() && mDataStorage[type]) mDataStorage[type]->unsubscribe(pKey);
+}
 
-            /*----------Functions----------*/
+/*
+    Blackboard::Board : setDeferredEvents - Set if callback events are raised when values are written or queued
+                                     until flushEvents is called
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-            //! Privatise the constructor/destructor to prevent external use
-            ValueMap() = default;
-            ~ValueMap() override {}
+    param[in] pDefer - Flags if callback events should be deferred
 
-            //! Override the functions used to remove keyed information
-            inline void wipeKey(const std::string& pKey) override;
-            inline void wipeAll() override;
-            inline void unsubscribe(const std::string& pKey) override;
-            inline void clearAllEvents() override;
-        };
-    }
+    Note: Turning deferral off raises any events that are still queued
+*/
+void Utilities::Blackboard::Board::setDeferredEvents(bool pDefer) {
+    //Set the flag
+    mEventQueue.setDeferring(pDefer);
 
-    #pragma region Template Definitions
-    #pragma region Blackboard
-    /*
-        Blackboard : templateToID<T> - Convert the template type T to a unique hash code
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Raise the remaining events
+    if (!pDefer) flushEvents();
+}
 
-        template T - A generic, non void type 
+/*
+    Blackboard::Board : flushEvents - Raise the callback events of all keys that have changed since the last flush
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        return size_t - Returns the ID as a size_t value
-    */
-    template<typename T>
-    inline size_t Utilities::Blackboard::templateToID() const {
-        //Get the type info
-        const std::type_info& type = typeid(T);
+    return size_t - Returns the number of notifications that were processed
+
+    Note: Repeated writes to a key between flushes raise its events once, with the value at the time
+          of the flush. Events queued by callbacks during the flush are raised by the next flush
+*/
+size_t Utilities::Blackboard::Board::flushEvents() {
+    //Take the current batch of notifications
+    size_t count = 0;
+    for (Templates::EventQueue::Node* node = mEventQueue.takeAll(); node; ++count) {
+        //Release the node before raising so nothing is lost if a callback throws
+        Templates::EventQueue::Node* next = node->mNext;
+        Templates::BaseMap* map = node->mMap;
+        const Key key = node->mKey;
+        delete node;
+        node = next;
 
-        //Return the hash code
-        return type.hash_code();
+        //Raise the events of the key
+        map->raisePending(key);
     }
+    return count;
+}
 
-    /*
-        Blackboard : supportType<T> - Using the type of the template ensure that there is a Value map to support 
-                                   holding data of its type
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+/*
+    Blackboard::Board : tick - Move the time of the Board forward, erasing the values whose lifetime has ended
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        template T - A generic, non void type
+    param[in] pNow - The current time, read from any clock that doesn't run backwards
+    param[in] pRaiseCallbacks - A flag to indicate if the subscribers of erased values are raised with the expired value (Default true)
 
-        return size_t - Returns the unique hash code for the template type T
-    */
-    template<typename T>
-    inline size_t Utilities::Blackboard::supportType() {
-        //Get the hash code for the type
-        size_t key = templateToID<T>();
+    return size_t - Returns the number of values that were erased
+
+    Note: Only the values that have expired are visited. Lifetimes are measured from the most recent tick,
+          so the clock's current time should be passed once before values are written with a lifetime
+*/
+size_t Utilities::Blackboard::Board::tick(std::chrono::milliseconds pNow, bool pRaiseCallbacks) {
+    //Take the timers that have expired
+    std::vector<Templates::TimerWheel::Timer> expired;
+    mTimers.advance(pNow.count() > 0 ? uint64_t(pNow.count()) : 0, expired);
 
-        //If there isn't a entry for the hash code create a new map
-        if (mDataStorage.find(key) == mDataStorage.end())
-            mDataStorage[key] = new Utilities::Templates::ValueMap<T>();
+    //Erase the values that haven't changed since their timer was added
+    size_t count = 0;
+    for (const Templates::TimerWheel::Timer& timer : expired)
+        if (timer.mMap->expire(timer.mID, timer.mDeadline, pRaiseCallbacks)) ++count;
+    return count;
+}
 
-        //Return the key
-        return key;
-    }
-    
-    /*
-        Blackboard : write<T> - Write a data value to the Blackboard 
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+/*
+    Blackboard::Board : setSnapshotMode - Set if the Board tracks the keys that change so that snapshots can be published
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        template T - A generic, non void type
+    param[in] pEnabled - Flags if snapshot mode should be enabled
 
-        param[in] pKey - The key value to save the data value at
-        param[in] pValue - The data value to be saved to the key location
-        param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::write(const std::string& pKey, const T& pValue, bool pRaiseCallbacks) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+    Note: The first two publishes after snapshot mode is enabled rebuild each buffer from all of the values
+*/
+void Utilities::Blackboard::Board::setSnapshotMode(bool pEnabled) {
+    //Prevent a publish from happening part way through the change
+    std::lock_guard<std::mutex> guard(mPublishLock);
+
+    //Changes weren't tracked while disabled, so the buffers must be rebuilt
+    if (pEnabled && !mSnapshotting.load(std::memory_order_acquire)) {
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> registryGuard(mDataLock);
+        for (auto map : mDataStorage)
+            if (map) map->invalidateSnapshots();
+    }
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    //Set the flag
+    mSnapshotting.store(pEnabled, std::memory_order_release);
+}
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+/*
+    Blackboard::Board : publish - Make the current values of the Board available to Snapshot readers
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+    return size_t - Returns the frame number of the published Snapshot, or 0 if snapshot mode isn't enabled
 
-        //Copy the data value across
-        map->mValues[pKey] = pValue;
+    Note: The frame that is rebuilt was made current two publishes ago, the publish waits for the
+          Snapshots that still pin it to be released. Values are copied one stripe at a time, so writes
+          made during the publish may only be partially included
+*/
+size_t Utilities::Blackboard::Board::publish() {
+    //Only allow a single publish at a time
+    std::lock_guard<std::mutex> guard(mPublishLock);
+    if (!mSnapshotting.load(std::memory_order_acquire)) return 0;
 
-        //Check event flag
-        if (pRaiseCallbacks) {
-            //Check for events to raise
-            if (map->mKeyEvents.find(pKey) != map->mKeyEvents.end() && map->mKeyEvents[pKey]) map->mKeyEvents[pKey](pKey);
-            if (map->mValueEvents.find(pKey) != map->mValueEvents.end() && map->mValueEvents[pKey]) map->mValueEvents[pKey](map->mValues[pKey]);
-            if (map->mPairEvents.find(pKey) != map->mPairEvents.end() && map->mPairEvents[pKey]) map->mPairEvents[pKey](pKey, map->mValues[pKey]);
-        }
+    //Find the frame that isn't current
+    const Templates::SnapshotFrame* front = mFront.load(std::memory_order_acquire);
+    const size_t buffer = (front == &mFrames[0] ? 1 : 0);
+    Templates::SnapshotFrame& frame = mFrames[buffer];
+
+    //Wait for the readers of the frame to release it, then stop new readers from pinning it
+    size_t readers = 0;
+    while (!frame.mReaders.compare_exchange_weak(readers, Templates::SnapshotFrame::WRITING, std::memory_order_acquire, std::memory_order_relaxed)) {
+        readers = 0;
+        std::this_thread::yield();
     }
 
-    /*
-        Blackboard : read<T> - Read the value of a key value from the Blackboard
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Bring the buffer of each of the types up to date
+    {
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> registryGuard(mDataLock);
+        frame.mTypes.assign(mDataStorage.size(), nullptr);
+        for (size_t i = 0; i < mDataStorage.size(); i++)
+            if (mDataStorage[i]) frame.mTypes[i] = mDataStorage[i]->publish(buffer);
+    }
 
-        template T - A generic, non void type
+    //Allow the frame to be read again and make it current
+    const size_t number = frame.mNumber = ++mPublishCount;
+    frame.mReaders.fetch_sub(Templates::SnapshotFrame::WRITING, std::memory_order_release);
+    mFront.store(&frame, std::memory_order_release);
+    return number;
+}
 
-        param[in] pKey - The key value to read the data value of
+/*
+    Blackboard::Board : changedSince - Find the keys of every type that have changed since a version of the Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        return const T& - Returns a constant reference to the data type of type T
-    */
-    template<typename T>
-    inline const T& Utilities::Blackboard::read(const std::string& pKey) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+    param[in] pVersion - The first version to include the changes of, 0 includes every change
+    param[out] pOut - The list that the keys that changed are appended to
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    return uint64_t - Returns the version to pass to the next call, which starts with the changes
+                      made after this one
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    Note: A key is listed once for each type that it changed in
+*/
+uint64_t Utilities::Blackboard::Board::changedSince(uint64_t pVersion, std::vector<Key>& pOut) {
+    //Start a new version, so that later changes are found by the next call
+    const uint64_t next = mVersion.fetch_add(1, std::memory_order_acq_rel) + 1;
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+    //Find the changes of each of the types
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+    for (auto map : mDataStorage)
+        if (map) map->changedSince(pVersion, pOut);
+    return next;
+}
 
-        //Return the value at the key location
-        return map->mValues[pKey];
-    }
+//! Define the values that identify a Board archive
+namespace Utilities { namespace Templates { namespace Archive {
+    static const char Magic[4] = { 'B', 'B', 'R', 'D' };
+    static const uint32_t Version = 1;
+    static const size_t Alignment = 64;
+} } }
 
-    /*
-        Blackboard : wipeTypeKey - Wipe the value stored at a specific key for the specified type
-        Author: Mitchell Croft
-        Created: 09/11/2016
-        Modified: 09/11/2016
+/*
+    Blackboard::Board : save - Write the values of the registered types to a binary archive
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        param[in] pKey - A string object containing the key of the value(s) to remove
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::wipeTypeKey(const std::string& pKey) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+    param[in] pStream - The stream that the archive is written to
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    return bool - Returns true if the archive was written successfully
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    Note: The archive starts with a header and the table of keys that it uses, followed by a section
+          for each type. Sections begin on a 64 byte boundary and hold the name of the type, the number
+          of values and the size of the section, so that types which aren't registered by the loading
+          process can be skipped
+*/
+bool Utilities::Blackboard::Board::save(std::ostream& pStream) {
+    //Write the sections of each of the registered types
+    Templates::ArchiveWriter sections;
+    uint32_t sectionCount = 0;
+    {
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> registryGuard(mDataLock);
+        for (size_t i = 0; i < mDataStorage.size(); i++) {
+            if (!mDataStorage[i]) continue;
+            const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(i);
+            if (!entry) continue;
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+            //Write the section header, the count and size are filled in once the values are written
+            sections.align(Templates::Archive::Alignment);
+            sections.writeString(entry->mName);
+            sections.write((uint8_t)entry->mBlock);
+            sections.write(entry->mSize);
+            const size_t countOffset = sections.getOffset();
+            sections.write((uint32_t)0);
+            sections.write((uint64_t)0);
+            const size_t start = sections.getOffset();
 
-        //Wipe the key from the value map
-        map->wipeKey(pKey);
+            //Write the values
+            const uint32_t count = entry->mSave(mDataStorage[i], sections);
+            sections.overwrite(countOffset, count);
+            sections.overwrite(countOffset + sizeof(uint32_t), (uint64_t)(sections.getOffset() - start));
+            ++sectionCount;
+        }
     }
 
-    /*
-        Blackboard : subscribe<T> - Set the callback event for a specific key value on a type of data
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Write the header and the key table
+    Templates::ArchiveWriter header;
+    header.write(Templates::Archive::Magic, sizeof(Templates::Archive::Magic));
+    header.write(Templates::Archive::Version);
+    header.write((uint32_t)sections.getKeys().size());
+    header.write(sectionCount);
+    for (uint32_t id : sections.getKeys())
+        header.writeString(Templates::KeyTable::get().find(id).getText());
+    header.align(Templates::Archive::Alignment);
+
+    //Stream the archive out
+    pStream.write(header.getBuffer().data(), (std::streamsize)header.getBuffer().size());
+    pStream.write(sections.getBuffer().data(), (std::streamsize)sections.getBuffer().size());
+    return (bool)pStream;
+}
 
-        template T - A generic, non void type
+/*
+    Blackboard::Board : load - Read the values of a binary archive from a stream
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        param[in] pKey - The key to assign the callback event to
-        param[in] pCb - A function pointer that takes in a constant string reference as its only parameter
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::subscribe(const std::string& pKey, EventKeyCallback<T> pCb) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+    param[in] pStream - The stream that the archive is read from
+    param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default false)
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    return bool - Returns true if the archive was read successfully
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    Note: Loaded values are written over the existing values of their keys, other keys are unaffected.
+          If the archive is malformed the values read before the error remain on the Board
+*/
+bool Utilities::Blackboard::Board::load(std::istream& pStream, bool pRaiseCallbacks) {
+    Templates::ArchiveReader reader(pStream);
+    return loadArchive(reader, pRaiseCallbacks);
+}
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+/*
+    Blackboard::Board : load - Read the values of a binary archive from memory
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        //Set the event callback
-        map->mKeyEvents[pKey] = pCb;
-    }
+    param[in] pData - The start of the archive, such as a mapped file
+    param[in] pSize - The size of the archive in bytes
+    param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default false)
 
-    /*
-        Blackboard : subscribe<T> - Set the callback event for a specific key value on a type of data
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    return bool - Returns true if the archive was read successfully
 
-        template T - A generic, non void type
+    Note: The archive is read in place without being copied
+*/
+bool Utilities::Blackboard::Board::load(const void* pData, size_t pSize, bool pRaiseCallbacks) {
+    Templates::ArchiveReader reader(pData, pSize);
+    return loadArchive(reader, pRaiseCallbacks);
+}
 
-        param[in] pKey - The key to assign the callback event to
-        param[in] pCb - A function pointer that takes in a constant reference to the new value that was assigned
-                        as its only parameters
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::subscribe(const std::string& pKey, EventValueCallback<T> pCb) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+/*
+    Blackboard::Board : loadArchive - Read the values of a binary archive onto the Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    param[in] pReader - The archive to read
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    return bool - Returns true if the archive was read successfully
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+    Note: Sections for types that aren't registered are skipped, a section for a registered type
+          that was saved with a different layout, or that is larger than the rest of an archive in
+          memory, fails the load
+*/
+bool Utilities::Blackboard::Board::loadArchive(Templates::ArchiveReader& pReader, bool pRaiseCallbacks) {
+    //Check the header
+    char magic[sizeof(Templates::Archive::Magic)];
+    uint32_t version, keyCount, sectionCount;
+    if (!pReader.read(magic, sizeof(magic)) || std::memcmp(magic, Templates::Archive::Magic, sizeof(magic)) ||
+        !pReader.read(version) || version != Templates::Archive::Version ||
+        !pReader.read(keyCount) || !pReader.read(sectionCount)) return false;
 
-        //Set the event callback
-        map->mValueEvents[pKey] = pCb;
+    //Intern the keys of the archive
+    std::vector<std::string> texts;
+    for (uint32_t i = 0; i < keyCount; i++) {
+        texts.emplace_back();
+        if (!pReader.readString(texts.back())) return false;
     }
+    std::vector<Key> keys;
+    Templates::KeyTable::get().intern(texts, keys);
 
-    /*
-        Blackboard : subscribe<T> - Set the callback event for a specific key value on a type of data
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Read each of the sections in turn
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        std::string name;
+        uint8_t block;
+        uint32_t size, count;
+        uint64_t length;
+        if (!pReader.align(Templates::Archive::Alignment) || !pReader.readString(name) || !pReader.read(block) ||
+            !pReader.read(size) || !pReader.read(count) || !pReader.read(length) || length > pReader.getRemaining()) return false;
 
-        template T - A generic, non void type 
+        //Skip the types that aren't registered
+        const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(name);
+        if (!entry) {
+            if (!pReader.skip((size_t)length)) return false;
+            continue;
+        }
 
-        param[in] pKey - The key to assign the callback event to
-        param[in] pCb - A function pointer that takes in a constant string reference and a constant reference to
-                        the new value as its only parameters
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::subscribe(const std::string& pKey, EventKeyValueCallback<T> pCb) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+        //Read the values, checking that they were saved with the same layout
+        const size_t start = pReader.getOffset();
+        if ((bool)block != entry->mBlock || size != entry->mSize || (uint64_t)count * sizeof(uint32_t) > length ||
+            !entry->mLoad(*this, pReader, count, keys, pRaiseCallbacks) || pReader.getOffset() - start != length) return false;
+    }
+    return true;
+}
+
+//! Define the values that identify a replicated delta packet
+namespace Utilities { namespace Templates { namespace Delta {
+    static const char Magic[4] = { 'B', 'B', 'D', 'L' };
+    static const uint32_t Version = 1;
+} } }
+
+/*
+    Blackboard::Replicator : Constructor - Initialise the Replicator for the singleton Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+Utilities::Blackboard::Replicator::Replicator() : Replicator(Blackboard::getBoard()) {}
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+/*
+    Blackboard::Replicator : Constructor - Initialise the Replicator for a Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    param[in] pBoard - The Board that changes are captured from and applied to
+*/
+Utilities::Blackboard::Replicator::Replicator(Board& pBoard) : mBoard(&pBoard), mVersion(0), mSequence(0), mExpected(0) {}
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+/*
+    Blackboard::Replicator : capture - Write the changes made to the Board since the last capture into a packet
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-        //Set the event callback
-        map->mPairEvents[pKey] = pCb;
-    }
+    param[out] pOut - The buffer that the packet is written to, this is emptied if nothing changed
 
-    /*
-        Blackboard : unsubscribe - Unsubscribe all events associated with a key value
-                                   for a specific type
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    return size_t - Returns the number of changes in the packet, or 0 if there is no packet to send
 
-        param[in] pKey - The key to remove the callback events from
-    */
-    template<typename T>
-    inline void Utilities::Blackboard::unsubscribe(const std::string& pKey) {
-        //Ensure that the singleton has been created
-        assert(mInstance);
+    Note: The packet starts with a header and the table of keys that it uses, followed by a section for
+          each type that changed. Each section holds the name of the type, the number of changes and
+          the size of the section, so that types which aren't registered by the receiver are skipped.
+          The first packet after construction or a reset holds every value of the registered types
+*/
+size_t Utilities::Blackboard::Replicator::capture(std::vector<char>& pOut) {
+    pOut.clear();
 
-        //Lock the data
-        std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    //Start a new version, so that later changes are found by the next capture
+    const uint64_t next = mBoard->mVersion.fetch_add(1, std::memory_order_acq_rel) + 1;
 
-        //Ensure the key for this type is supported
-        size_t key = mInstance->supportType<T>();
+    //Write the sections of each of the registered types that changed
+    Templates::ArchiveWriter sections;
+    uint32_t sectionCount = 0;
+    size_t count = 0;
+    {
+        std::shared_lock<Utilities::Templates::SharedRecursiveMutex> registryGuard(mBoard->mDataLock);
+        if (mSent.size() < mBoard->mDataStorage.size()) mSent.resize(mBoard->mDataStorage.size());
+        for (size_t i = 0; i < mBoard->mDataStorage.size(); i++) {
+            if (!mBoard->mDataStorage[i]) continue;
+            const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(i);
+            if (!entry) continue;
 
-        //Cast the Value Map to the type of T
-        Utilities::Templates::ValueMap<T>* map = (Utilities::Templates::ValueMap<T>*)(mInstance->mDataStorage[key]);
+            //Write the section header, the count and size are filled in once the changes are written
+            const size_t sectionStart = sections.getOffset();
+            sections.writeString(entry->mName);
+            sections.write((uint8_t)entry->mBlock);
+            sections.write(entry->mSize);
+            const size_t countOffset = sections.getOffset();
+            sections.write((uint32_t)0);
+            sections.write((uint64_t)0);
+            const size_t start = sections.getOffset();
 
-        //Pass the unsubscribe key to the Value Map
-        map->unsubscribe(pKey);
+            //Write the changes, removing the section if there weren't any
+            const uint32_t changes = entry->mSaveDelta(mBoard->mDataStorage[i], sections, mVersion, mSent[i]);
+            if (!changes) {
+                sections.truncate(sectionStart);
+                continue;
+            }
+            sections.overwrite(countOffset, changes);
+            sections.overwrite(countOffset + sizeof(uint32_t), (uint64_t)(sections.getOffset() - start));
+            count += changes;
+            ++sectionCount;
+        }
     }
-    #pragma endregion
+    mVersion = next;
+    if (!count) return 0;
 
-    #pragma region ValueMap
-    /*
-        ValueMap<T> : wipeKey - Clear the value associated with a key value
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Write the header and the key table
+    Templates::ArchiveWriter header;
+    header.write(Templates::Delta::Magic, sizeof(Templates::Delta::Magic));
+    header.write(Templates::Delta::Version);
+    header.write(mSequence++);
+    header.write((uint32_t)sections.getKeys().size());
+    header.write(sectionCount);
+    for (uint32_t id : sections.getKeys())
+        header.writeString(Templates::KeyTable::get().find(id).getText());
 
-        template T - A generic, non void type
+    //Join the packet together
+    pOut.reserve(header.getBuffer().size() + sections.getBuffer().size());
+    pOut.insert(pOut.end(), header.getBuffer().begin(), header.getBuffer().end());
+    pOut.insert(pOut.end(), sections.getBuffer().begin(), sections.getBuffer().end());
+    return count;
+}
 
-        param[in] pKey - The key value to clear the entry of
-    */
-    template<typename T>
-    inline void Utilities::Templates::ValueMap<T>::wipeKey(const std::string& pKey) { mValues.erase(pKey); }
+/*
+    Blackboard::Replicator : apply - Apply a packet captured by another Replicator to the Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-    /*
-        ValueMap<T> : wipeAll - Erase all data stored in the map
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    param[in] pData - The start of the packet
+    param[in] pSize - The size of the packet in bytes
+    param[in] pRaiseCallbacks - A flag to indicate if callback events should be raised (Default true)
 
-        template T - A generic, non void type
-    */
-    template<typename T>
-    inline void Utilities::Templates::ValueMap<T>::wipeAll() { mValues.clear(); }
+    return bool - Returns true if the packet was applied, or false if it is malformed or out of order
 
-    /*
-        ValueMap<T> : unsubscribe - Remove all callback events associated with a key value
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    Note: A packet with the first sequence number, sent after the sender was constructed or reset,
+          is always accepted. If a packet fails part way through, the changes read before the error
+          remain on the Board and later packets are rejected until the sender is reset
+*/
+bool Utilities::Blackboard::Replicator::apply(const void* pData, size_t pSize, bool pRaiseCallbacks) {
+    Templates::ArchiveReader reader(pData, pSize);
 
-        template T - A generic, non void type
+    //Check the header and the order of the packet
+    char magic[sizeof(Templates::Delta::Magic)];
+    uint32_t version, sequence, keyCount, sectionCount;
+    if (!reader.read(magic, sizeof(magic)) || std::memcmp(magic, Templates::Delta::Magic, sizeof(magic)) ||
+        !reader.read(version) || version != Templates::Delta::Version || !reader.read(sequence) ||
+        (sequence != 0 && sequence != mExpected) || !reader.read(keyCount) || !reader.read(sectionCount)) return false;
 
-        param[in] pKey - The key to wipe all callback events associated with
-    */
-    template<typename T>
-    inline void Utilities::Templates::ValueMap<T>::unsubscribe(const std::string& pKey) {
-        //Find iterators
-        auto key = mKeyEvents.find(pKey);
-        auto val = mValueEvents.find(pKey);
-        auto pair = mPairEvents.find(pKey);
+    //Start again from the full set of values when the sender has been reset
+    if (sequence == 0) mReceived.clear();
+    mExpected = UINT32_MAX;
 
-        //Remove the callbacks
-        if (key != mKeyEvents.end()) mKeyEvents.erase(key);
-        if (val != mValueEvents.end()) mValueEvents.erase(val);
-        if (pair != mPairEvents.end()) mPairEvents.erase(pair);
+    //Intern the keys of the packet
+    std::vector<std::string> texts;
+    for (uint32_t i = 0; i < keyCount; i++) {
+        texts.emplace_back();
+        if (!reader.readString(texts.back())) return false;
     }
+    std::vector<Key> keys;
+    Templates::KeyTable::get().intern(texts, keys);
 
-    /*
-        ValueMap<T> : clearAllEvents - Clear all event callbacks stored within the Value map
-        Author: Mitchell Croft
-        Created: 08/11/2016
-        Modified: 08/11/2016
+    //Apply each of the sections in turn
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        std::string name;
+        uint8_t block;
+        uint32_t size, count;
+        uint64_t length;
+        if (!reader.readString(name) || !reader.read(block) || !reader.read(size) || !reader.read(count) || !reader.read(length) ||
+            length > reader.getRemaining()) return false;
 
-        template T - A generic, non void type
-    */
-    template<typename T>
-    inline void Utilities::Templates::ValueMap<T>::clearAllEvents() {
-        //Clear all event maps
-        mKeyEvents.clear();
-        mValueEvents.clear();
-        mPairEvents.clear();
+        //Skip the types that aren't registered
+        const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(name);
+        if (!entry) {
+            if (!reader.skip((size_t)length)) return false;
+            continue;
+        }
+
+        //Apply the changes, checking that they were captured with the same layout
+        if (mReceived.size() <= entry->mType) mReceived.resize(entry->mType + 1);
+        const size_t start = reader.getOffset();
+        if ((bool)block != entry->mBlock || size != entry->mSize || (uint64_t)count * (sizeof(uint32_t) + sizeof(uint8_t)) > length ||
+            !entry->mLoadDelta(*mBoard, reader, count, keys, mReceived[entry->mType], pRaiseCallbacks) || reader.getOffset() - start != length) return false;
     }
-    #pragma endregion
-    #pragma endregion
-}
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/////                                                                                                                      ////
-/////                                                      Object Definition                                               ////
-/////                                                                                                                      ////
-/////  Include a define for _BLACKBOARD_ in a single .cpp file inside of the project to use the Blackboard functionality   ////
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#ifdef _BLACKBOARD_
-//! Define the Blackboards static singleton instance
-Utilities::Blackboard* Utilities::Blackboard::mInstance = nullptr;
+    //Expect the packet that follows this one
+    mExpected = sequence + 1;
+    return true;
+}
 
 /*
-    Blackboard : create - Initialise the Blackboard singleton for use
+    Blackboard::Replicator : reset - Start replicating again from the full set of values
     Author: Mitchell Croft
-    Created: 08/11/2016
-    Modified: 08/11/2016
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-    return bool - Returns true if the Blackboard was initialised successfully
+    Note: The next capture holds every value of the registered types, and is accepted by a receiver
+          regardless of the packets it has applied before
 */
-bool Utilities::Blackboard::create() {
-    //Check if the Blackboard has already been set up
-    if (isReady()) destroy();
-
-    //Create the instance
-    mInstance = new Blackboard();
-
-    //Return success state
-    return (mInstance != nullptr);
+void Utilities::Blackboard::Replicator::reset() {
+    mVersion = 0;
+    mSequence = 0;
+    mExpected = 0;
+    mSent.clear();
+    mReceived.clear();
 }
 
 /*
-    Blackboard : destroy - Deallocate all data associated with the Blackboard and destroy
-                           the singleton instance
+    Blackboard::Board : getStats - Retrieve the access statistics of the Board
     Author: Mitchell Croft
-    Created: 08/11/2016
-    Modified: 08/11/2016
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[out] pOut - The object that the statistics are copied into
+
+    Note: When BLACKBOARD_STATS isn't defined the statistics are left empty and flagged as disabled
 */
-void Utilities::Blackboard::destroy() {
-    //Check that there is an instance to destroy
-    if (mInstance) {
-        //Lock the data values
-        mInstance->mDataLock.lock();
+void Utilities::Blackboard::Board::getStats(Stats& pOut) {
+    //Clear the previous statistics
+    pOut.mTypes.clear();
+    pOut.mKeys.clear();
 
-        //Delete all Value Map values
-        for (auto pair : mInstance->mDataStorage)
-            delete pair.second;
+#ifdef BLACKBOARD_STATS
+    //Copy the statistics of the type registry
+    pOut.mEnabled = true;
+    pOut.mRegistryContended = mRegistryStats.mContended.load();
+    pOut.mRegistryWaitNanoseconds = mRegistryStats.mWaitNanoseconds.load();
 
-        //Unlock the data
-        mInstance->mDataLock.unlock();
+    //Share the registry while the Value maps are read
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
 
-        //Delete the singleton 
-        delete mInstance;
+    //Copy the statistics of each type and its keys
+    for (size_t i = 0; i < mDataStorage.size(); i++) {
+        Templates::BaseMap* map = mDataStorage[i];
+        if (!map) continue;
 
-        //Reset the instance pointer
-        mInstance = nullptr;
+        //Name the type if it has been registered
+        const Templates::CodecTable::Entry* entry = Templates::CodecTable::get().find(i);
+        const Templates::TypeStats& stats = map->mStats;
+        pOut.mTypes.push_back({ i, (entry ? entry->mName : std::string()), stats.mReads.load(), stats.mWrites.load(), stats.mCallbacks.load(),
+                                stats.mCallbackNanoseconds.load(), stats.mLock.mContended.load(), stats.mLock.mWaitNanoseconds.load(), stats.mAllocatedBytes.load() });
+        map->collectStats(pOut.mKeys);
     }
+#else
+    //Flag that no statistics are recorded
+    pOut.mEnabled = false;
+    pOut.mRegistryContended = pOut.mRegistryWaitNanoseconds = 0;
+#endif
 }
 
 /*
-    Blackboard : wipeKey - Clear all data associated with the passed in key value
+    Blackboard::Board : resetStats - Reset the access statistics of the Board to 0
     Author: Mitchell Croft
-    Created: 08/11/2016
-    Modified: 08/11/2016
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-    param[in] pKey - A string object containing the key of the value(s) to remove
+    Note: The allocations of the Value maps are kept
 */
-void Utilities::Blackboard::wipeKey(const std::string& pKey) {
-    //Ensure that the singleton has been created
-    assert(mInstance);
-
-    //Lock the data
-    std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+void Utilities::Blackboard::Board::resetStats() {
+#ifdef BLACKBOARD_STATS
+    //Reset the registry
+    mRegistryStats.reset();
 
-    //Loop through the different type collections
-    for (auto pair : mInstance->mDataStorage)
-        pair.second->wipeKey(pKey);
+    //Reset each of the types
+    std::shared_lock<Utilities::Templates::SharedRecursiveMutex> guard(mDataLock);
+    for (Templates::BaseMap* map : mDataStorage)
+        if (map) map->resetStats();
+#endif
 }
 
 /*
-    Blackboard : wipeBoard - Clear all data stored on the Blackboard
+    Blackboard::Board : dumpStats - Write a summary of the access statistics of the Board to a stream
     Author: Mitchell Croft
-    Created: 08/11/2016
-    Modified: 08/11/2016
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-    param[in] pWipeCallbacks - Flags if all of the set event callbacks should be cleared
-                               as well as the values (Default false)
+    param[in] pStream - The stream that the summary is written to
+
+    Note: Every type is listed, along with the 16 keys that have been accessed the most
 */
-void Utilities::Blackboard::wipeBoard(bool pWipeCallbacks) {
-    //Ensure that the singleton has been created
-    assert(mInstance);
+void Utilities::Blackboard::Board::dumpStats(std::ostream& pStream) {
+    //Collect the statistics
+    Stats stats;
+    getStats(stats);
+    if (!stats.mEnabled) {
+        pStream << "Blackboard statistics are disabled, define BLACKBOARD_STATS to record them" << std::endl;
+        return;
+    }
 
-    //Lock the data
-    std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
+    //Find the names of the types, falling back to the type ID for those that aren't registered
+    auto nameOf = [&stats](size_t pType) -> std::string {
+        for (const Stats::Type& type : stats.mTypes)
+            if (type.mType == pType && !type.mName.empty()) return type.mName;
+        return "type " + std::to_string(pType);
+    };
 
-    //Loop through all stored Value maps
-    for (auto pair : mInstance->mDataStorage) {
-        //Clear the data values
-        pair.second->wipeAll();
+    //Write the registry and each of the types
+    pStream << "Registry: " << stats.mRegistryContended << " contended locks (" << stats.mRegistryWaitNanoseconds << "ns waiting)" << std::endl;
+    for (const Stats::Type& type : stats.mTypes) {
+        pStream << nameOf(type.mType) << ": " << type.mReads << " reads, " << type.mWrites << " writes, " <<
+                   type.mCallbacks << " callbacks (" << type.mCallbackNanoseconds << "ns), " <<
+                   type.mContended << " contended locks (" << type.mWaitNanoseconds << "ns waiting), " <<
+                   type.mAllocatedBytes << " bytes allocated" << std::endl;
+    }
 
-        //Clear the callbacks
-        if (pWipeCallbacks) pair.second->clearAllEvents();
+    //Write the keys that have been accessed the most
+    const size_t count = std::min<size_t>(stats.mKeys.size(), 16);
+    std::partial_sort(stats.mKeys.begin(), stats.mKeys.begin() + count, stats.mKeys.end(), [](const Stats::KeyAccess& pLeft, const Stats::KeyAccess& pRight) {
+        return (pLeft.mReads + pLeft.mWrites > pRight.mReads + pRight.mWrites);
+    });
+    for (size_t i = 0; i < count; i++) {
+        const Stats::KeyAccess& access = stats.mKeys[i];
+        pStream << "  " << access.mKey.getText() << " (" << nameOf(access.mType) << "): " << access.mReads << " reads, " << access.mWrites << " writes" << std::endl;
     }
 }
 
 /*
-    Blackboard : unsubscribeAll - Remove the associated callback events for a key
-                                  from every type map 
+    Blackboard::Board : dumpStats - Pass the access statistics of the Board to a callback
     Author: Mitchell Croft
-    Created: 08/11/2016
-    Modified: 08/11/2016
+    Created: 14/10/2026
+    Modified: 14/10/2026
 
-    param[in] pKey - The key to remove the callback events from
+    param[in] pCallback - The function that is passed the statistics, such as one that forwards them to telemetry
+    param[in] pUserData - The user data that is passed to the callback (Default nullptr)
 */
-void Utilities::Blackboard::unsubscribeAll(const std::string& pKey) {
-    //Ensure that the singleton has been created
-    assert(mInstance);
-
-    //Lock the data
-    std::lock_guard<std::recursive_mutex> guard(mInstance->mDataLock);
-
-    //Loop through all stored Value maps
-    for (auto pair : mInstance->mDataStorage)
-        pair.second->unsubscribe(pKey);
+void Utilities::Blackboard::Board::dumpStats(StatsCallback pCallback, void* pUserData) {
+    //Collect the statistics and pass them on
+    Stats stats;
+    getStats(stats);
+    pCallback(stats, pUserData);
 }
-#endif  //_BLACKBOARD_
\ No newline at end of file
+#endif  //_BLACKBOARD_
@@ -0,0 +1,729 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+#include <initializer_list>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+//! Include the Blackboard
+#include "Blackboard.h"
+using Utilities::Blackboard;
+
+//! Define the number of times each measurement is repeated, the median result is reported
+const unsigned int DEFAULT_REPEATS = 5;
+
+//! Define the number of operations each thread performs per measurement
+const unsigned int OPERATIONS_PER_THREAD = 200000;
+
+//! Define the number of distinct value types used by the type count benchmarks
+const size_t MAX_TYPE_COUNT = 64;
+
+#pragma region Allocation Tracking
+//! Store the number of allocations made through the global operator new
+static std::atomic<size_t> gAllocations(0);
+
+//! Keep the allocation helpers out of line, if they are inlined into the replaced operators the compiler pairs the
+//! malloc and free calls with operator new and delete and reports them as mismatched (-Wmismatched-new-delete)
+#ifdef _MSC_VER
+#define ALLOCATION_HELPER __declspec(noinline)
+#else
+#define ALLOCATION_HELPER __attribute__((noinline))
+#endif
+
+//! Count an allocation and request the memory for it, over aligned requests use the aligned allocator
+ALLOCATION_HELPER static void* allocate(size_t pSize, size_t pAlignment = 0) noexcept {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (!pSize) pSize = 1;
+    if (pAlignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return std::malloc(pSize);
+#ifdef _MSC_VER
+    return _aligned_malloc(pSize, pAlignment);
+#else
+    return std::aligned_alloc(pAlignment, (pSize + pAlignment - 1) / pAlignment * pAlignment);
+#endif
+}
+
+//! Release memory requested by allocate with the same alignment
+ALLOCATION_HELPER static void release(void* pMemory, size_t pAlignment = 0) noexcept {
+#ifdef _MSC_VER
+    if (pAlignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) { _aligned_free(pMemory); return; }
+#else
+    (void)pAlignment;
+#endif
+    std::free(pMemory);
+}
+
+//! Count an allocation that must succeed
+static void* allocateOrThrow(size_t pSize, size_t pAlignment = 0) {
+    if (void* memory = allocate(pSize, pAlignment)) return memory;
+    throw std::bad_alloc();
+}
+
+//! Replace the global allocation functions to count the allocations made during each measurement
+void* operator new(size_t pSize) { return allocateOrThrow(pSize); }
+void* operator new[](size_t pSize) { return allocateOrThrow(pSize); }
+void* operator new(size_t pSize, const std::nothrow_t&) noexcept { return allocate(pSize); }
+void* operator new[](size_t pSize, const std::nothrow_t&) noexcept { return allocate(pSize); }
+void* operator new(size_t pSize, std::align_val_t pAlignment) { return allocateOrThrow(pSize, size_t(pAlignment)); }
+void* operator new[](size_t pSize, std::align_val_t pAlignment) { return allocateOrThrow(pSize, size_t(pAlignment)); }
+void* operator new(size_t pSize, std::align_val_t pAlignment, const std::nothrow_t&) noexcept { return allocate(pSize, size_t(pAlignment)); }
+void* operator new[](size_t pSize, std::align_val_t pAlignment, const std::nothrow_t&) noexcept { return allocate(pSize, size_t(pAlignment)); }
+void operator delete(void* pMemory) noexcept { release(pMemory); }
+void operator delete[](void* pMemory) noexcept { release(pMemory); }
+void operator delete(void* pMemory, size_t) noexcept { release(pMemory); }
+void operator delete[](void* pMemory, size_t) noexcept { release(pMemory); }
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept { release(pMemory); }
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept { release(pMemory); }
+void operator delete(void* pMemory, std::align_val_t pAlignment) noexcept { release(pMemory, size_t(pAlignment)); }
+void operator delete[](void* pMemory, std::align_val_t pAlignment) noexcept { release(pMemory, size_t(pAlignment)); }
+void operator delete(void* pMemory, size_t, std::align_val_t pAlignment) noexcept { release(pMemory, size_t(pAlignment)); }
+void operator delete[](void* pMemory, size_t, std::align_val_t pAlignment) noexcept { release(pMemory, size_t(pAlignment)); }
+void operator delete(void* pMemory, std::align_val_t pAlignment, const std::nothrow_t&) noexcept { release(pMemory, size_t(pAlignment)); }
+void operator delete[](void* pMemory, std::align_val_t pAlignment, const std::nothrow_t&) noexcept { release(pMemory, size_t(pAlignment)); }
+#pragma endregion
+
+#pragma region Value Types
+/*
+ *      Name: Payload
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Provide a value type of a fixed size. The tag value
+ *      allows for creating many distinct types of the same
+ *      size for the type count benchmarks.
+**/
+template<size_t TSize, size_t TTag = 0>
+struct Payload {
+    unsigned char mBytes[TSize];
+    Payload() { std::memset(mBytes, 0, TSize); }
+    explicit Payload(unsigned int pSeed) { std::memset(mBytes, (int)(pSeed & 0xFF), TSize); }
+};
+
+/*
+ *      Name: FlatPayload
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Provide a value type of a fixed size that is stored
+ *      using the flat storage policy, so that it can be
+ *      compared against the default policy in a single run.
+**/
+template<size_t TSize>
+struct FlatPayload : Payload<TSize> {
+    FlatPayload() = default;
+    explicit FlatPayload(unsigned int pSeed) : Payload<TSize>(pSeed) {}
+};
+
+//! Store FlatPayload values using the flat storage policy
+namespace Utilities { namespace Templates {
+    template<size_t TSize> struct StoragePolicy<FlatPayload<TSize>> { typedef FlatStorage Type; };
+} }
+#pragma endregion
+
+#pragma region Benchmark Functionality
+/*
+ *      Name: Options
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Store the command line options controlling which
+ *      benchmarks are run and how they are measured
+**/
+struct Options {
+    unsigned int mMaxThreads = 32;
+    unsigned int mRepeats = DEFAULT_REPEATS;
+    std::string mFilter;
+};
+
+//! Store the options for the current run
+static Options gOptions;
+
+//! Store a sink value to prevent the benchmarked operations being optimised away
+static std::atomic<size_t> gSink(0);
+
+/*
+ *      Name: Result
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Store the cost of a single operation of a benchmark
+**/
+struct Result {
+    double mNanoseconds;
+    double mAllocations;
+};
+
+/*
+    runThreaded - Run a function on a number of threads at the same time and time how long it takes
+                  for all of them to complete
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TFunc - A callable type that takes the index of the thread as an unsigned int
+
+    param[in] pThreadCount - The number of threads to run the function on
+    param[in] pFunc - The function to run on each of the threads
+
+    return double - Returns the number of seconds taken for all threads to complete
+*/
+template<typename TFunc>
+double runThreaded(unsigned int pThreadCount, TFunc& pFunc) {
+    //Run on the calling thread if there is only one
+    if (pThreadCount == 1) {
+        auto begin = std::chrono::steady_clock::now();
+        pFunc(0u);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    //Store a flag used to release all of the threads at once
+    std::atomic<bool> start(false);
+    std::atomic<unsigned int> ready(0);
+
+    //Create the threads
+    std::vector<std::thread> threads;
+    threads.reserve(pThreadCount);
+    for (unsigned int i = 0; i < pThreadCount; i++) {
+        threads.emplace_back([&, i]() {
+            //Wait for the release
+            ready.fetch_add(1);
+            while (!start.load()) std::this_thread::yield();
+
+            //Run the function
+            pFunc(i);
+        });
+    }
+
+    //Wait for all threads to be ready
+    while (ready.load() < pThreadCount) std::this_thread::yield();
+
+    //Release the threads and time their completion
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : threads) thread.join();
+    auto end = std::chrono::steady_clock::now();
+
+    //Return the elapsed time
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+/*
+    measure - Repeatedly run a benchmark function and find the median cost of each operation
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TFunc - A callable type that takes the index of the thread as an unsigned int
+
+    param[in] pThreadCount - The number of threads to run the function on
+    param[in] pOperations - The total number of operations performed by all threads per run
+    param[in] pFunc - The function to run on each of the threads
+
+    return Result - Returns the median time and allocation count of each operation
+*/
+template<typename TFunc>
+Result measure(unsigned int pThreadCount, double pOperations, TFunc pFunc) {
+    //Warm up the caches and any lazily created storage
+    runThreaded(pThreadCount, pFunc);
+
+    //Run the repeats
+    std::vector<Result> results;
+    for (unsigned int i = 0; i < gOptions.mRepeats; i++) {
+        const size_t allocations = gAllocations.load();
+        const double seconds = runThreaded(pThreadCount, pFunc);
+        results.push_back({ seconds * 1000000000.0 / pOperations, (double)(gAllocations.load() - allocations) / pOperations });
+    }
+
+    //Return the median result
+    std::sort(results.begin(), results.end(), [](const Result& pLeft, const Result& pRight) { return pLeft.mNanoseconds < pRight.mNanoseconds; });
+    return results[results.size() / 2];
+}
+
+/*
+    isEnabled - Check if a benchmark matches the filter that was supplied on the command line
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name of the benchmark
+
+    return bool - Returns true if the benchmark should be run
+*/
+bool isEnabled(const std::string& pName) { return (gOptions.mFilter.empty() || pName.find(gOptions.mFilter) != std::string::npos); }
+
+/*
+    printHeader - Output the header of the results table
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+*/
+void printHeader() {
+    std::cout << std::left << std::setw(24) << "Benchmark" <<
+                 std::setw(32) << "Parameters" <<
+                 std::right << std::setw(8) << "Threads" <<
+                 std::setw(14) << "ns/op" <<
+                 std::setw(14) << "allocs/op" << std::endl <<
+                 std::string(92, '-') << std::endl;
+}
+
+/*
+    printResult - Output a single row of the benchmark results
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pName - The name of the benchmark that was run
+    param[in] pParameters - A description of the parameters the benchmark was run with
+    param[in] pThreadCount - The number of threads the benchmark was run on
+    param[in] pResult - The measured cost of each operation
+*/
+void printResult(const std::string& pName, const std::string& pParameters, unsigned int pThreadCount, const Result& pResult) {
+    std::cout << std::left << std::setw(24) << pName <<
+                 std::setw(32) << pParameters <<
+                 std::right << std::setw(8) << pThreadCount <<
+                 std::setw(14) << std::fixed << std::setprecision(2) << pResult.mNanoseconds <<
+                 std::setw(14) << std::fixed << std::setprecision(3) << pResult.mAllocations << std::endl;
+}
+
+/*
+    makeKeys - Create a set of key strings
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pCount - The number of keys to create
+
+    return std::vector<std::string> - Returns the key strings
+*/
+std::vector<std::string> makeKeys(size_t pCount) {
+    std::vector<std::string> keys;
+    keys.reserve(pCount);
+    for (size_t i = 0; i < pCount; i++)
+        keys.push_back("Benchmark_Key_" + std::to_string(i));
+    return keys;
+}
+
+/*
+    keyIndex - Get the index of the key used by an operation, spreading consecutive operations across the keys
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pOperation - The index of the operation
+    param[in] pThread - The index of the thread performing the operation
+    param[in] pKeyCount - The number of keys available
+
+    return size_t - Returns the index of the key to use
+*/
+inline size_t keyIndex(size_t pOperation, size_t pThread, size_t pKeyCount) { return (pOperation * 7919 + pThread * 104729) % pKeyCount; }
+
+/*
+    describe - Create the parameter description of a benchmark row
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TValue - The type of value that was benchmarked
+
+    param[in] pKeyCount - The number of keys the benchmark used
+    param[in] pExtra - Additional text to add to the description
+
+    return std::string - Returns the description
+*/
+template<typename TValue>
+std::string describe(size_t pKeyCount, const std::string& pExtra = "") {
+    const bool flat = std::is_same<typename Utilities::Templates::StoragePolicy<TValue>::Type, Utilities::Templates::FlatStorage>::value;
+    return "keys=" + std::to_string(pKeyCount) + " size=" + std::to_string(sizeof(TValue)) + (flat ? " flat" : " node") + pExtra;
+}
+#pragma endregion
+
+#pragma region Benchmarks
+/*
+    benchmarkAccess - Measure the cost of writing and reading values for a value type and key count
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TValue - The type of value to write and read
+
+    param[in] pKeyCount - The number of keys that are written and read
+    param[in] pThreadCount - The number of threads performing the operations
+*/
+template<typename TValue>
+void benchmarkAccess(size_t pKeyCount, unsigned int pThreadCount) {
+    //Create the key values that will be used
+    const std::vector<std::string> keys = makeKeys(pKeyCount);
+    std::vector<Blackboard::Key> atoms;
+    for (const std::string& key : keys) atoms.emplace_back(key);
+
+    //Populate the Blackboard
+    for (size_t i = 0; i < pKeyCount; i++) Blackboard::write(keys[i], TValue((unsigned int)i));
+    const double operations = (double)pThreadCount * OPERATIONS_PER_THREAD;
+
+    //Write by key string
+    if (isEnabled("write(string)")) printResult("write(string)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        const TValue value(pThread);
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            Blackboard::write(keys[keyIndex(i, pThread, pKeyCount)], value);
+    }));
+
+    //Write by interned Key
+    if (isEnabled("write(Key)")) printResult("write(Key)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        const TValue value(pThread);
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            Blackboard::write(atoms[keyIndex(i, pThread, pKeyCount)], value);
+    }));
+
+    //Write by interned Key through a Batch, committing every 64 writes
+    if (isEnabled("write(Batch)")) printResult("write(Batch)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        const TValue value(pThread);
+        Blackboard::Batch batch = Blackboard::batch();
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++) {
+            batch.write(atoms[keyIndex(i, pThread, pKeyCount)], value);
+            if (i % 64 == 63) batch.commit();
+        }
+    }));
+
+    //Read by key string
+    if (isEnabled("read(string)")) printResult("read(string)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        size_t total = 0;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            total += Blackboard::read<TValue>(keys[keyIndex(i, pThread, pKeyCount)]).mBytes[0];
+        gSink.fetch_add(total);
+    }));
+
+    //Read by interned Key
+    if (isEnabled("read(Key)")) printResult("read(Key)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        size_t total = 0;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            total += Blackboard::read<TValue>(atoms[keyIndex(i, pThread, pKeyCount)]).mBytes[0];
+        gSink.fetch_add(total);
+    }));
+
+    //Read by typed key, which finds the interned Key from its precomputed hash
+    if (isEnabled("read(TypedKey)")) printResult("read(TypedKey)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        std::vector<Utilities::BlackboardKey<TValue>> typed;
+        typed.reserve(pKeyCount);
+        for (const std::string& key : keys) typed.emplace_back(key);
+        size_t total = 0;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            total += Blackboard::read(typed[keyIndex(i, pThread, pKeyCount)]).mBytes[0];
+        gSink.fetch_add(total);
+    }));
+
+    //Sweep every value of the type, counting each value visited as an operation
+    if (isEnabled("forEach")) printResult("forEach", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int) {
+        size_t total = 0;
+        for (size_t visited = 0; visited < OPERATIONS_PER_THREAD;)
+            visited += Blackboard::forEach<TValue>([&total](const TValue& pValue) { total += pValue.mBytes[0]; });
+        gSink.fetch_add(total);
+    }));
+
+    //Copy out by interned Key
+    if (isEnabled("tryRead(Key)")) printResult("tryRead(Key)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        size_t total = 0;
+        TValue value;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            if (Blackboard::tryRead<TValue>(atoms[keyIndex(i, pThread, pKeyCount)], value)) total += value.mBytes[0];
+        gSink.fetch_add(total);
+    }));
+
+    //Read by pre-resolved Handle
+    if (isEnabled("read(Handle)")) printResult("read(Handle)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        std::vector<Blackboard::Handle<TValue>> handles;
+        handles.reserve(pKeyCount);
+        for (const Blackboard::Key& atom : atoms) handles.push_back(Blackboard::getHandle<TValue>(atom));
+
+        size_t total = 0;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            total += Blackboard::read(handles[keyIndex(i, pThread, pKeyCount)]).mBytes[0];
+        gSink.fetch_add(total);
+    }));
+
+    //Read through a chain of two scoped Boards that don't hold the values
+    if (isEnabled("read(scoped)")) {
+        Blackboard::Board squad(&Blackboard::getBoard());
+        Blackboard::Board agent(&squad);
+        printResult("read(scoped)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+            size_t total = 0;
+            for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+                total += agent.read<TValue>(atoms[keyIndex(i, pThread, pKeyCount)]).mBytes[0];
+            gSink.fetch_add(total);
+        }));
+    }
+
+    //Read with a 5% mix of writes, copying the values as the keys are shared with the writers
+    if (isEnabled("read/write 95/5")) printResult("read/write 95/5", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, [&](unsigned int pThread) {
+        const TValue value(pThread);
+        TValue copy;
+        size_t total = 0;
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++) {
+            const Blackboard::Key& key = atoms[keyIndex(i, pThread, pKeyCount)];
+            if (i % 20 == 0) Blackboard::write(key, value, false);
+            else if (Blackboard::tryRead<TValue>(key, copy)) total += copy.mBytes[0];
+        }
+        gSink.fetch_add(total);
+    }));
+
+    //Remove the values for the next benchmark
+    Blackboard::wipeBoard(true);
+}
+
+//! Define the callback events used by the dispatch benchmark
+static std::atomic<size_t> gEventsRaised(0);
+template<typename TValue> void onKeyEvent(const std::string&) { gEventsRaised.fetch_add(1, std::memory_order_relaxed); }
+template<typename TValue> void onValueEvent(const TValue& pValue) { gEventsRaised.fetch_add(pValue.mBytes[0], std::memory_order_relaxed); }
+template<typename TValue> void onPairEvent(const std::string&, const TValue& pValue) { gEventsRaised.fetch_add(pValue.mBytes[0], std::memory_order_relaxed); }
+
+/*
+    benchmarkDispatch - Measure the cost of the callback events raised when writing values
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TValue - The type of value to write
+
+    param[in] pKeyCount - The number of keys that are written
+    param[in] pThreadCount - The number of threads performing the operations
+*/
+template<typename TValue>
+void benchmarkDispatch(size_t pKeyCount, unsigned int pThreadCount) {
+    //Check the benchmark is enabled
+    if (!isEnabled("dispatch")) return;
+
+    //Create the key values that will be used
+    std::vector<Blackboard::Key> atoms;
+    for (const std::string& key : makeKeys(pKeyCount)) atoms.emplace_back(key);
+    const double operations = (double)pThreadCount * OPERATIONS_PER_THREAD;
+
+    //Define the write loop that is measured
+    auto writes = [&](unsigned int pThread) {
+        const TValue value(pThread);
+        for (size_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+            Blackboard::write(atoms[keyIndex(i, pThread, pKeyCount)], value);
+    };
+
+    //Write without any subscribers
+    printResult("dispatch(none)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, writes));
+
+    //Write with a key event on every key
+    for (const Blackboard::Key& atom : atoms) Blackboard::subscribe<TValue>(atom, &onKeyEvent<TValue>);
+    printResult("dispatch(key)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, writes));
+
+    //Write with all three events on every key
+    for (const Blackboard::Key& atom : atoms) {
+        Blackboard::subscribe<TValue>(atom, &onValueEvent<TValue>);
+        Blackboard::subscribe<TValue>(atom, &onPairEvent<TValue>);
+    }
+    printResult("dispatch(all)", describe<TValue>(pKeyCount), pThreadCount, measure(pThreadCount, operations, writes));
+
+    //Remove the values and events for the next benchmark
+    Blackboard::wipeBoard(true);
+}
+
+/*
+    populateTypes - Write a value for every key to each of the first pTypeCount Payload types
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    template TTags - The tags of the Payload types that can be used
+
+    param[in] pKeys - The keys to write values for
+    param[in] pTypeCount - The number of types to write values to
+*/
+template<size_t... TTags>
+void populateTypes(const std::vector<Blackboard::Key>& pKeys, size_t pTypeCount, std::index_sequence<TTags...>) {
+    for (const Blackboard::Key& key : pKeys)
+        (void)std::initializer_list<int>{ (TTags < pTypeCount ? (Blackboard::write(key, Payload<16, TTags>(), false), 0) : 0)... };
+}
+
+/*
+    benchmarkWipe - Measure the cost of wiping keys and the entire board as the number of value types grows
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKeyCount - The number of keys that are written to each type
+    param[in] pTypeCount - The number of value types that are written
+*/
+void benchmarkWipe(size_t pKeyCount, size_t pTypeCount) {
+    //Create the key values that will be used
+    std::vector<Blackboard::Key> atoms;
+    for (const std::string& key : makeKeys(pKeyCount)) atoms.emplace_back(key);
+    const std::string parameters = "keys=" + std::to_string(pKeyCount) + " types=" + std::to_string(pTypeCount);
+
+    //Wipe each of the keys in turn, repopulating between the runs
+    if (isEnabled("wipeKey")) {
+        std::vector<Result> results;
+        for (unsigned int repeat = 0; repeat < gOptions.mRepeats; repeat++) {
+            populateTypes(atoms, pTypeCount, std::make_index_sequence<MAX_TYPE_COUNT>());
+            const size_t allocations = gAllocations.load();
+            auto begin = std::chrono::steady_clock::now();
+            for (const Blackboard::Key& key : atoms) Blackboard::wipeKey(key);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            results.push_back({ seconds * 1000000000.0 / pKeyCount, (double)(gAllocations.load() - allocations) / pKeyCount });
+        }
+        std::sort(results.begin(), results.end(), [](const Result& pLeft, const Result& pRight) { return pLeft.mNanoseconds < pRight.mNanoseconds; });
+        printResult("wipeKey", parameters, 1, results[results.size() / 2]);
+    }
+
+    //Wipe the entire board, repopulating between the runs
+    if (isEnabled("wipeBoard")) {
+        std::vector<Result> results;
+        for (unsigned int repeat = 0; repeat < gOptions.mRepeats; repeat++) {
+            populateTypes(atoms, pTypeCount, std::make_index_sequence<MAX_TYPE_COUNT>());
+            const size_t allocations = gAllocations.load();
+            auto begin = std::chrono::steady_clock::now();
+            Blackboard::wipeBoard();
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            results.push_back({ seconds * 1000000000.0, (double)(gAllocations.load() - allocations) });
+        }
+        std::sort(results.begin(), results.end(), [](const Result& pLeft, const Result& pRight) { return pLeft.mNanoseconds < pRight.mNanoseconds; });
+        printResult("wipeBoard", parameters, 1, results[results.size() / 2]);
+    }
+}
+
+/*
+    benchmarkTeardown - Measure the cost of destroying a populated singleton Board
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKeyCount - The number of keys that are written to each type
+    param[in] pTypeCount - The number of value types that are written
+
+    Note: The singleton is recreated for each run and is left as an empty Board without a pool
+*/
+void benchmarkTeardown(size_t pKeyCount, size_t pTypeCount) {
+    //Create the key values that will be used
+    std::vector<Blackboard::Key> atoms;
+    for (const std::string& key : makeKeys(pKeyCount)) atoms.emplace_back(key);
+    const std::string parameters = "keys=" + std::to_string(pKeyCount) + " types=" + std::to_string(pTypeCount);
+
+    //Destroy the board with and without a memory pool and a background teardown
+    const struct { const char* mName; bool mPooled; bool mBackground; } teardowns[] = {
+        { "destroy", false, false },
+        { "destroy(pooled)", true, false },
+        { "destroy(background)", true, true }
+    };
+    for (const auto& teardown : teardowns) {
+        if (!isEnabled(teardown.mName)) continue;
+        std::vector<Result> results;
+        for (unsigned int repeat = 0; repeat < gOptions.mRepeats; repeat++) {
+            Blackboard::create(teardown.mPooled);
+            populateTypes(atoms, pTypeCount, std::make_index_sequence<MAX_TYPE_COUNT>());
+            auto begin = std::chrono::steady_clock::now();
+            Blackboard::destroy(teardown.mBackground);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            Blackboard::waitForTeardown();
+            results.push_back({ seconds * 1000000000.0, 0.0 });
+        }
+        std::sort(results.begin(), results.end(), [](const Result& pLeft, const Result& pRight) { return pLeft.mNanoseconds < pRight.mNanoseconds; });
+        printResult(teardown.mName, parameters, 1, results[results.size() / 2]);
+        Blackboard::create();
+    }
+}
+#pragma endregion
+
+/*
+    parseOptions - Read the benchmark options from the command line
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] argc - The number of command line arguments
+    param[in] argv - The command line arguments
+
+    return bool - Returns true if the options were valid
+*/
+bool parseOptions(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        const std::string option = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (option == "--threads" && hasValue) gOptions.mMaxThreads = std::max(1, std::atoi(argv[++i]));
+        else if (option == "--repeats" && hasValue) gOptions.mRepeats = std::max(1, std::atoi(argv[++i]));
+        else if (option == "--filter" && hasValue) gOptions.mFilter = argv[++i];
+        else {
+            std::cout << "Usage: Benchmark [--threads max] [--repeats count] [--filter name]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    main - Run the Blackboard benchmarks and output the results
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] argc - The number of command line arguments
+    param[in] argv - The command line arguments
+
+    return int - Returns the success state of the program
+*/
+int main(int argc, char* argv[]) {
+    //Read the options
+    if (!parseOptions(argc, argv)) return EXIT_FAILURE;
+
+    //Create the Blackboard
+    if (!Blackboard::create()) {
+        std::cout << "Failed to create the Blackboard...." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    //Output the configuration
+    std::cout << "Blackboard benchmarks (" << OPERATIONS_PER_THREAD << " operations per thread, median of " << gOptions.mRepeats << " runs)" << std::endl << std::endl;
+    printHeader();
+
+    //Vary the key count, value size and storage policy on a single thread
+    for (size_t keyCount : { 16, 1024, 65536 }) {
+        benchmarkAccess<Payload<4>>(keyCount, 1);
+        benchmarkAccess<Payload<64>>(keyCount, 1);
+        benchmarkAccess<Payload<1024>>(keyCount, 1);
+        benchmarkAccess<FlatPayload<4>>(keyCount, 1);
+        benchmarkAccess<FlatPayload<64>>(keyCount, 1);
+    }
+
+    //Vary the thread count
+    for (unsigned int threadCount = 2; threadCount <= gOptions.mMaxThreads; threadCount *= 2) {
+        benchmarkAccess<Payload<4>>(1024, threadCount);
+        benchmarkAccess<FlatPayload<4>>(1024, threadCount);
+    }
+
+    //Callback dispatch
+    for (unsigned int threadCount = 1; threadCount <= gOptions.mMaxThreads; threadCount *= 2)
+        benchmarkDispatch<Payload<4>>(1024, threadCount);
+    benchmarkDispatch<Payload<1024>>(1024, 1);
+
+    //Vary the type count for the wipe functions, each run registers more types than the last
+    for (size_t typeCount : { 1, 16, 64 })
+        benchmarkWipe(1024, typeCount);
+
+    //Tear down a board holding around half a million values
+    benchmarkTeardown(65536, 8);
+
+    //Output the sink value
+    std::cout << std::endl << "(Checksum " << (gSink.load() + gEventsRaised.load()) << ")" << std::endl;
+
+    //Destroy the Blackboard
+    Blackboard::destroy();
+
+    //Exit successful
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,500 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <cstring>
+
+//! Include the Blackboard
+#include "Blackboard.h"
+using Utilities::Blackboard;
+
+//! Define the default number of threads that access the Blackboard at once
+const unsigned int DEFAULT_THREADS = 8;
+
+//! Define the default number of seconds that the threads are run for
+const double DEFAULT_SECONDS = 5.0;
+
+//! Define the default number of keys that the threads share
+const size_t DEFAULT_KEY_COUNT = 256;
+
+//! Define the number of subscriptions that each thread can hold at once
+const size_t MAX_SUBSCRIPTIONS = 32;
+
+//! Define the number of failures that are described before the rest are only counted
+const size_t MAX_REPORTED_FAILURES = 16;
+
+#pragma region Value Types
+/*
+ *      Name: Checked
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Provide a small trivially copyable value that carries
+ *      the index of the key it was written to and a check
+ *      word, so that torn or misplaced values can be found.
+**/
+struct Checked {
+    uint32_t mKey = 0;
+    uint32_t mSequence = 0;
+    uint64_t mCheck = 0;
+
+    Checked() = default;
+    Checked(uint32_t pKey, uint32_t pSequence) : mKey(pKey), mSequence(pSequence), mCheck(mix(pKey, pSequence)) {}
+
+    //! Find the check word for a key index and sequence number
+    static inline uint64_t mix(uint32_t pKey, uint32_t pSequence) {
+        uint64_t value = ((uint64_t)pKey << 32 | pSequence) * 0x9E3779B97F4A7C15ull;
+        return (value ^ (value >> 29)) | 1;
+    }
+
+    //! Check that the value is whole and belongs to a key
+    inline bool isValid(uint32_t pKey) const { return (mKey == pKey && mCheck == mix(mKey, mSequence)); }
+};
+
+/*
+    makeText - Create a text value that holds the index of the key it is written to
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The index of the key that the value is written to
+    param[in] pSequence - A number that varies the length and contents of the value
+
+    return std::string - Returns the text value
+*/
+std::string makeText(uint32_t pKey, uint32_t pSequence) {
+    return std::to_string(pKey) + ':' + std::string(pSequence % 64, (char)('a' + pSequence % 26));
+}
+
+/*
+    isValidText - Check that a text value is whole and belongs to a key
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The index of the key that the value was read from
+    param[in] pText - The text value that was read
+
+    return bool - Returns true if the value was created by makeText for the key
+*/
+bool isValidText(uint32_t pKey, const std::string& pText) {
+    //Check the prefix names the key
+    const std::string prefix = std::to_string(pKey) + ':';
+    if (pText.compare(0, prefix.size(), prefix) != 0) return false;
+
+    //Check the filler is a single repeated letter
+    for (size_t i = prefix.size(); i < pText.size(); i++)
+        if (pText[i] != pText[prefix.size()]) return false;
+    return true;
+}
+#pragma endregion
+
+#pragma region Stress Functionality
+/*
+ *      Name: Options
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Store the command line options controlling how the
+ *      Blackboard is stressed
+**/
+struct Options {
+    unsigned int mThreads = DEFAULT_THREADS;
+    double mSeconds = DEFAULT_SECONDS;
+    size_t mKeyCount = DEFAULT_KEY_COUNT;
+    uint64_t mSeed = 1;
+};
+
+//! Store the options for the current run
+static Options gOptions;
+
+//! Define the operations that the threads choose between
+enum class EOperation { Write, WriteText, Read, ReadText, ReadSnapshot, Publish, Modify, Batch, Subscribe, Unsubscribe, WipeKey, WipeBoard, ForEach, Count };
+
+//! Store the name of each operation
+static const char* const OPERATION_NAMES[(size_t)EOperation::Count] = { "write", "write(text)", "tryRead", "tryRead(text)", "snapshot", "publish", "modify", "batch", "subscribe", "unsubscribe", "wipeKey", "wipeBoard", "forEach" };
+
+//! Store the relative chance of each operation being chosen
+static const unsigned int OPERATION_WEIGHTS[(size_t)EOperation::Count] = { 2400, 1000, 2600, 1000, 1000, 20, 600, 500, 300, 300, 1000, 2, 8 };
+
+//! Store the keys that are shared by the threads, and the interned Key of each
+static std::vector<std::string> gKeyNames;
+static std::vector<Blackboard::Key> gKeys;
+
+//! Store the number of values that failed their checks and the number of callback events that were raised
+static std::atomic<size_t> gFailures(0);
+static std::atomic<size_t> gCallbacks(0);
+
+//! Store a mutex for ordering the failure descriptions
+static std::mutex gReportLock;
+
+/*
+ *      Name: Random
+ *      Author: Mitchell Croft
+ *      Created: 14/10/2026
+ *      Modified: 14/10/2026
+ *
+ *      Purpose:
+ *      Generate the random numbers of a single thread, so
+ *      that a run can be repeated from its seed
+**/
+struct Random {
+    uint64_t mState;
+
+    explicit Random(uint64_t pSeed) : mState(pSeed * 0x9E3779B97F4A7C15ull + 0x2545F4914F6CDD1Dull) {}
+
+    //! Get the next random number
+    inline uint64_t next() {
+        mState ^= mState << 13;
+        mState ^= mState >> 7;
+        mState ^= mState << 17;
+        return mState;
+    }
+
+    //! Get a random number below a limit
+    inline size_t below(size_t pLimit) { return (size_t)(next() % pLimit); }
+};
+
+/*
+    reportFailure - Count a value that failed its check, describing the first few
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pOperation - The name of the operation that found the value
+    param[in] pKey - The index of the key that the value was found at
+*/
+void reportFailure(const char* pOperation, uint32_t pKey) {
+    if (gFailures.fetch_add(1) >= MAX_REPORTED_FAILURES) return;
+    std::lock_guard<std::mutex> guard(gReportLock);
+    std::cout << "FAILED: " << pOperation << " found an invalid value at " << gKeyNames[pKey] << std::endl;
+}
+
+/*
+    findKeyIndex - Find the index of a key from its text
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The text of the key
+
+    return uint32_t - Returns the index of the key
+*/
+uint32_t findKeyIndex(const std::string& pKey) { return (uint32_t)std::strtoul(pKey.c_str() + 4, nullptr, 10); }
+
+/*
+    onChecked - Check the values that are passed to the callback events of the keys
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pKey - The key that was written to
+    param[in] pValue - The value that was written
+    param[in] pUserData - Unused
+*/
+void onChecked(const std::string& pKey, const Checked& pValue, void*) {
+    gCallbacks.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t key = findKeyIndex(pKey);
+    if (!pValue.isValid(key)) reportFailure("callback", key);
+}
+
+/*
+    runThread - Perform random operations on the Blackboard until the end time is reached
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] pIndex - The index of the thread
+    param[in] pEnd - The time to stop at
+    param[out] pCounts - The list that the number of times each operation was performed is stored in
+*/
+void runThread(unsigned int pIndex, std::chrono::steady_clock::time_point pEnd, std::vector<size_t>& pCounts) {
+    //Find the total weight of the operations
+    unsigned int totalWeight = 0;
+    for (unsigned int weight : OPERATION_WEIGHTS) totalWeight += weight;
+
+    Random random(gOptions.mSeed + pIndex);
+    std::vector<Blackboard::Subscription> subscriptions;
+    uint32_t sequence = 0;
+    pCounts.assign((size_t)EOperation::Count, 0);
+
+    //Check the clock every few operations so that it doesn't dominate the run
+    while (std::chrono::steady_clock::now() < pEnd) {
+        for (int repeat = 0; repeat < 64; repeat++) {
+            //Choose the operation and the key it is applied to
+            unsigned int roll = (unsigned int)random.below(totalWeight);
+            size_t operation = 0;
+            while (roll >= OPERATION_WEIGHTS[operation]) roll -= OPERATION_WEIGHTS[operation++];
+            const uint32_t key = (uint32_t)random.below(gKeys.size());
+            ++sequence;
+
+            //Perform the operation
+            switch ((EOperation)operation) {
+            case EOperation::Write:
+                Blackboard::write(gKeys[key], Checked(key, sequence));
+                break;
+            case EOperation::WriteText:
+                Blackboard::write(gKeys[key], makeText(key, sequence));
+                break;
+            case EOperation::Read: {
+                Checked value;
+                if (Blackboard::tryRead(gKeys[key], value) && !value.isValid(key)) reportFailure("tryRead", key);
+                break;
+            }
+            case EOperation::ReadText: {
+                std::string value;
+                if (Blackboard::tryRead(gKeys[key], value) && !isValidText(key, value)) reportFailure("tryRead(text)", key);
+                break;
+            }
+            case EOperation::ReadSnapshot: {
+                const Blackboard::Snapshot snapshot = Blackboard::getSnapshot();
+                if (!snapshot.isValid()) break;
+                if (const Checked* value = snapshot.find<Checked>(gKeys[key])) if (!value->isValid(key)) reportFailure("snapshot", key);
+                if (const std::string* value = snapshot.find<std::string>(gKeys[key])) if (!isValidText(key, *value)) reportFailure("snapshot(text)", key);
+                break;
+            }
+            case EOperation::Publish:
+                Blackboard::publish();
+                break;
+            case EOperation::Modify:
+                Blackboard::modify<Checked>(gKeys[key], [key, sequence](Checked& pValue) {
+                    if (pValue.mCheck && !pValue.isValid(key)) reportFailure("modify", key);
+                    pValue = Checked(key, sequence);
+                });
+                break;
+            case EOperation::Batch: {
+                Blackboard::Batch batch = Blackboard::batch();
+                for (int i = 0; i < 4; i++) {
+                    const uint32_t batched = (uint32_t)random.below(gKeys.size());
+                    batch.write(gKeys[batched], Checked(batched, sequence));
+                }
+                batch.commit();
+                break;
+            }
+            case EOperation::Subscribe:
+                if (subscriptions.size() < MAX_SUBSCRIPTIONS) subscriptions.push_back(Blackboard::subscribe<Checked>(gKeys[key], onChecked, nullptr));
+                break;
+            case EOperation::Unsubscribe:
+                if (!subscriptions.empty()) {
+                    const size_t index = random.below(subscriptions.size());
+                    Blackboard::unsubscribe(subscriptions[index]);
+                    subscriptions[index] = subscriptions.back();
+                    subscriptions.pop_back();
+                }
+                break;
+            case EOperation::WipeKey:
+                if (random.next() & 1) Blackboard::wipeKey(gKeys[key]);
+                else Blackboard::wipeTypeKey<Checked>(gKeys[key]);
+                break;
+            case EOperation::WipeBoard:
+                Blackboard::wipeBoard((random.next() & 7) == 0);
+                break;
+            case EOperation::ForEach:
+                Blackboard::forEach<Checked>([](const Blackboard::Key& pKey, const Checked& pValue) {
+                    const uint32_t index = findKeyIndex(pKey.getText());
+                    if (!pValue.isValid(index)) reportFailure("forEach", index);
+                });
+                break;
+            default:
+                break;
+            }
+            ++pCounts[operation];
+        }
+    }
+
+    //Remove the remaining subscriptions
+    for (const Blackboard::Subscription& subscription : subscriptions) Blackboard::unsubscribe(subscription);
+}
+
+/*
+    checkBoard - Check every value that is left on the Blackboard once the threads have stopped
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the number of values that were checked
+*/
+size_t checkBoard() {
+    size_t count = Blackboard::forEach<Checked>([](const Blackboard::Key& pKey, const Checked& pValue) {
+        const uint32_t index = findKeyIndex(pKey.getText());
+        if (!pValue.isValid(index)) reportFailure("final check", index);
+    });
+    count += Blackboard::forEach<std::string>([](const Blackboard::Key& pKey, const std::string& pValue) {
+        const uint32_t index = findKeyIndex(pKey.getText());
+        if (!isValidText(index, pValue)) reportFailure("final check(text)", index);
+    });
+    return count;
+}
+
+/*
+    checkArchives - Check that corrupt copies of an archive of the Blackboard are rejected without throwing
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    return size_t - Returns the number of corrupt archives that were loaded
+*/
+size_t checkArchives() {
+    //Save the values that are left
+    std::ostringstream output;
+    Blackboard::save(output);
+    const std::string archive = output.str();
+
+    //Load an archive from memory and as a stream onto a separate Board, it must not throw and may be required to fail
+    Blackboard::Board board;
+    size_t attempts = 0;
+    auto attempt = [&board, &attempts](const std::string& pArchive, bool pMustFail, const char* pCase) {
+        bool failed;
+        try {
+            std::istringstream input(pArchive);
+            const bool fromMemory = board.load(pArchive.data(), pArchive.size());
+            const bool fromStream = board.load(input);
+            failed = (pMustFail && (fromMemory || fromStream));
+        } catch (const std::exception&) { failed = true; }
+        ++attempts;
+        if (failed && gFailures.fetch_add(1) < MAX_REPORTED_FAILURES) {
+            std::lock_guard<std::mutex> guard(gReportLock);
+            std::cout << "FAILED: a " << pCase << " archive was not rejected" << std::endl;
+        }
+    };
+
+    //Give each section an impossible value count and length
+    for (const std::string& name : { std::string("Checked"), std::string("text") }) {
+        const uint32_t length = (uint32_t)name.size();
+        const size_t section = archive.find(std::string((const char*)&length, sizeof(length)) + name);
+        if (section == std::string::npos) continue;
+        std::string corrupt = archive;
+        const uint32_t count = 0xFFFFFFF0u;
+        const uint64_t size = UINT64_MAX;
+        const size_t offset = section + sizeof(length) + name.size() + sizeof(uint8_t) + sizeof(uint32_t);
+        std::memcpy(&corrupt[offset], &count, sizeof(count));
+        attempt(corrupt, true, "huge count");
+        std::memcpy(&corrupt[offset + sizeof(count)], &size, sizeof(size));
+        attempt(corrupt, true, "huge section");
+    }
+
+    //Cut the archive short and flip bytes at a spread of offsets
+    const size_t step = std::max<size_t>(1, archive.size() / 256);
+    for (size_t offset = 0; offset < archive.size(); offset += step) {
+        attempt(archive.substr(0, offset), true, "truncated");
+        std::string corrupt = archive;
+        corrupt[offset] = (char)~corrupt[offset];
+        attempt(corrupt, false, "corrupt");
+    }
+    return attempts;
+}
+#pragma endregion
+
+/*
+    parseOptions - Read the stress options from the command line
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] argc - The number of command line arguments
+    param[in] argv - The command line arguments
+
+    return bool - Returns true if the options were valid
+*/
+bool parseOptions(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        const std::string option = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (option == "--threads" && hasValue) gOptions.mThreads = std::max(1, std::atoi(argv[++i]));
+        else if (option == "--seconds" && hasValue) gOptions.mSeconds = std::max(0.01, std::atof(argv[++i]));
+        else if (option == "--keys" && hasValue) gOptions.mKeyCount = (size_t)std::max(1, std::atoi(argv[++i]));
+        else if (option == "--seed" && hasValue) gOptions.mSeed = std::strtoull(argv[++i], nullptr, 10);
+        else {
+            std::cout << "Usage: Stress [--threads count] [--seconds duration] [--keys count] [--seed value]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    main - Stress the Blackboard from a number of threads and output the throughput of each operation
+    Author: Mitchell Croft
+    Created: 14/10/2026
+    Modified: 14/10/2026
+
+    param[in] argc - The number of command line arguments
+    param[in] argv - The command line arguments
+
+    return int - Returns EXIT_FAILURE if any of the values failed their checks
+*/
+int main(int argc, char* argv[]) {
+    //Read the options
+    if (!parseOptions(argc, argv)) return EXIT_FAILURE;
+
+    //Create the Blackboard
+    if (!Blackboard::create()) {
+        std::cout << "Failed to create the Blackboard...." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    //Register the value types so that the Blackboard can be saved
+    Blackboard::registerType<Checked>("Checked");
+    Blackboard::registerType<std::string>("text");
+
+    //Track the changed keys so that the threads can publish Snapshots
+    Blackboard::setSnapshotMode(true);
+
+    //Create the keys that the threads share
+    for (size_t i = 0; i < gOptions.mKeyCount; i++) {
+        gKeyNames.push_back("key_" + std::to_string(i));
+        gKeys.emplace_back(gKeyNames.back());
+    }
+
+    //Output the configuration
+    std::cout << "Blackboard stress test (" << gOptions.mThreads << " threads, " << gOptions.mSeconds << " seconds, " << gOptions.mKeyCount << " keys, seed " << gOptions.mSeed << ")" << std::endl << std::endl;
+
+    //Run the threads
+    std::vector<std::vector<size_t>> counts(gOptions.mThreads);
+    std::vector<std::thread> threads;
+    auto begin = std::chrono::steady_clock::now();
+    auto end = begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(gOptions.mSeconds));
+    for (unsigned int i = 0; i < gOptions.mThreads; i++)
+        threads.emplace_back(runThread, i, end, std::ref(counts[i]));
+    for (std::thread& thread : threads) thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    //Check the values that are left
+    const size_t remaining = checkBoard();
+    const size_t archives = checkArchives();
+
+    //Output the throughput of each operation
+    size_t total = 0;
+    std::cout << std::left << std::setw(16) << "operation" << std::right << std::setw(14) << "count" << std::setw(16) << "ops/s" << std::endl;
+    std::cout << std::string(46, '-') << std::endl;
+    for (size_t operation = 0; operation < (size_t)EOperation::Count; operation++) {
+        size_t count = 0;
+        for (const std::vector<size_t>& thread : counts) count += thread[operation];
+        total += count;
+        std::cout << std::left << std::setw(16) << OPERATION_NAMES[operation] << std::right << std::setw(14) << count << std::setw(16) << std::fixed << std::setprecision(0) << count / seconds << std::endl;
+    }
+    std::cout << std::string(46, '-') << std::endl;
+    std::cout << std::left << std::setw(16) << "total" << std::right << std::setw(14) << total << std::setw(16) << std::fixed << std::setprecision(0) << total / seconds << std::endl << std::endl;
+    std::cout << "Callback events raised: " << gCallbacks.load() << ", values remaining: " << remaining << ", corrupt archives loaded: " << archives << std::endl;
+
+    //Destroy the Blackboard
+    Blackboard::destroy();
+
+    //Output the result
+    const size_t failures = gFailures.load();
+    std::cout << (failures ? "FAILED: " + std::to_string(failures) + " invalid values were found" : std::string("PASSED")) << std::endl;
+    return (failures ? EXIT_FAILURE : EXIT_SUCCESS);
+}